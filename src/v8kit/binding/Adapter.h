@@ -2,16 +2,22 @@
 #include "ReturnValuePolicy.h"
 #include "v8kit/core/Fwd.h"
 
+#include <memory>
+
 namespace v8kit::binding {
 
 namespace adapter {
 
 template <typename R, typename... Args>
-decltype(auto) wrapScriptCallback(Local<Value> const& value);
+std::function<R(Args...)> wrapScriptCallback(Local<Value> const& value);
 
 template <typename Fn>
 FunctionCallback wrapFunction(Fn&& fn, ReturnValuePolicy policy);
 
+// releaseEngine: checked on every call, when set the C++ call runs with the engine unlocked (see releases_engine)
+template <typename Fn>
+FunctionCallback wrapFunction(Fn&& fn, ReturnValuePolicy policy, std::shared_ptr<bool const> releaseEngine);
+
 template <typename... Overload>
 FunctionCallback wrapOverloadFunction(ReturnValuePolicy policy, Overload&&... fn);
 
@@ -28,6 +34,9 @@ SetterCallback wrapSetter(Fn&& setter);
 template <typename Ty, bool forceReadonly = false>
 std::pair<GetterCallback, SetterCallback> wrapStaticMember(Ty&& member, ReturnValuePolicy policy);
 
+template <typename Fn>
+FunctionCallback wrapAsyncFunction(Fn&& fn);
+
 
 template <typename C, typename... Args>
 ConstructorCallback wrapConstructor();
@@ -35,9 +44,26 @@ ConstructorCallback wrapConstructor();
 template <typename C, typename Fn>
 InstanceMethodCallback wrapInstanceMethod(Fn&& fn, ReturnValuePolicy policy);
 
+template <typename C, typename Fn>
+InstanceMethodCallback
+wrapInstanceMethod(Fn&& fn, ReturnValuePolicy policy, std::shared_ptr<bool const> releaseEngine);
+
 template <typename C, typename... Overload>
 InstanceMethodCallback wrapOverloadMethodAndExtraPolicy(Overload&&... fn);
 
+template <typename C, typename Fn>
+InstanceMethodCallback wrapAsyncInstanceMethod(Fn&& fn);
+
+template <typename C, typename Fn>
+InstanceGetterCallback wrapInstanceGetter(Fn&& getter, ReturnValuePolicy policy);
+
+template <typename C, typename Fn>
+InstanceSetterCallback wrapInstanceSetter(Fn&& setter);
+
+template <typename C, bool forceReadonly = false, typename M, typename Owner>
+std::pair<InstanceGetterCallback, InstanceSetterCallback>
+wrapInstanceMember(M Owner::* member, ReturnValuePolicy policy);
+
 } // namespace adapter
 
 
@@ -1,12 +1,27 @@
 #pragma once
+#include "ScratchArena.h"
 #include "traits/FunctionTraits.h"
 #include "v8kit/binding/TypeConverter.h"
+#include "v8kit/core/Engine.h"
+#include "v8kit/core/EngineScope.h"
 #include "v8kit/core/Exception.h"
 #include "v8kit/core/MetaInfo.h"
 #include "v8kit/core/Reference.h"
 #include "v8kit/core/Value.h"
+#include "v8kit/core/WorkerPool.h"
 
+#include <array>
 #include <cassert>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 
 namespace v8kit::binding::adapter {
@@ -31,10 +46,110 @@ struct StorageTypeDetector {
 template <typename TargetT>
 using StorageType_t = StorageTypeDetector<TargetT>::type;
 
+
+/**
+ * @brief Argument types converted into the per-call ScratchArena instead of owning storage
+ * @note Specialized on the raw type (std::string_view, std::span<T>, std::pmr::string, std::pmr::vector<T>)
+ */
+template <typename Raw>
+struct ScratchArgConverter;
+
+template <typename T>
+concept ScratchConvertible = requires { &ScratchArgConverter<std::remove_cvref_t<T>>::convert; };
+
+template <typename T, bool = ScratchConvertible<T>>
+struct ArgStorageDetector {
+    using type = StorageType_t<T>;
+};
+template <typename T>
+struct ArgStorageDetector<T, true> {
+    using type = std::remove_cvref_t<T>; // views / pmr containers, backed by the arena
+};
+
+template <typename T>
+using ArgStorage_t = ArgStorageDetector<T>::type;
+
+template <typename T>
+decltype(auto) convertArg(Local<Value> const& value, ScratchArena& arena) {
+    if constexpr (ScratchConvertible<T>) {
+        return ScratchArgConverter<std::remove_cvref_t<T>>::convert(value, arena);
+    } else {
+        return toCpp<T>(value);
+    }
+}
+
+template <>
+struct ScratchArgConverter<std::string_view> {
+    static std::string_view convert(Local<Value> const& value, ScratchArena& arena) {
+        auto   str    = value.asString();
+        size_t length = str.utf8Length();
+        if (length == 0) return {};
+        char* data = arena.allocate<char>(length);
+        return {data, str.writeUtf8(data, length)};
+    }
+};
+
+template <>
+struct ScratchArgConverter<std::pmr::string> {
+    static std::pmr::string convert(Local<Value> const& value, ScratchArena& arena) {
+        auto             str = value.asString();
+        std::pmr::string result{str.utf8Length(), '\0', arena.resource()};
+        result.resize(str.writeUtf8(result.data(), result.size()));
+        return result;
+    }
+};
+
+template <typename T>
+    requires std::is_trivially_destructible_v<std::remove_const_t<T>>
+struct ScratchArgConverter<std::span<T>> {
+    using E = std::remove_const_t<T>;
+
+    static std::span<T> convert(Local<Value> const& value, ScratchArena& arena) {
+        auto   array  = value.asArray();
+        size_t length = array.length();
+        E*     data   = arena.allocate<E>(length);
+        if constexpr (concepts::NumberLike<E> && !std::same_as<E, bool>) {
+            if (array.readNumbers(std::span<E>{data, length})) {
+                return {data, length};
+            }
+        }
+        size_t count = 0;
+        array.forEach([&](size_t index, Local<Value> const& element) {
+            if (index >= length) return false;
+            std::construct_at(data + index, convertArg<E>(element, arena));
+            count = index + 1;
+            return true;
+        });
+        return {data, count};
+    }
+};
+
+template <typename T>
+struct ScratchArgConverter<std::pmr::vector<T>> {
+    static std::pmr::vector<T> convert(Local<Value> const& value, ScratchArena& arena) {
+        auto                array = value.asArray();
+        std::pmr::vector<T> result{arena.resource()};
+        if constexpr (concepts::NumberLike<T> && !std::same_as<T, bool>) {
+            result.resize(array.length());
+            if (array.readNumbers(std::span<T>{result})) {
+                return result;
+            }
+            result.clear();
+        }
+        result.reserve(array.length());
+        array.forEach([&](size_t, Local<Value> const& element) { result.push_back(convertArg<T>(element, arena)); });
+        return result;
+    }
+};
+
+/**
+ * @brief Convert call arguments into a tuple of storage types
+ * @param arena per-call scratch memory, must outlive the returned tuple
+ */
 template <typename Tuple, std::size_t... Is>
-inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_sequence<Is...>) {
-    using SafeTuple = std::tuple<StorageType_t<std::tuple_element_t<Is, Tuple>>...>;
-    return SafeTuple{toCpp<std::tuple_element_t<Is, Tuple>>(args[Is])...};
+inline decltype(auto) ConvertArgsToTuple(Arguments const& args, ScratchArena& arena, std::index_sequence<Is...>) {
+    using SafeTuple = std::tuple<ArgStorage_t<std::tuple_element_t<Is, Tuple>>...>;
+    return SafeTuple{convertArg<std::tuple_element_t<Is, Tuple>>(args[Is], arena)...};
 }
 
 
@@ -43,49 +158,120 @@ inline decltype(auto) ConvertArgsToTuple(Arguments const& args, std::index_seque
 // ---------------------
 
 // JavaScript lambda -> std::function
+/**
+ * @brief Copyable handle of a script function, invoked as a C++ callable
+ * @note Calls made from inside the same engine (the common case: a native function calling back into a
+ *       script-provided callback) only open a HandleScope; argv lives on the stack.
+ */
+template <typename R, typename... Args>
+class ScriptCallback {
+    struct State {
+        Engine*          engine;
+        Global<Function> function;
+
+        explicit State(Engine* engine, Local<Function> const& function) : engine(engine), function(function) {}
+    };
+    std::shared_ptr<State const> state_; // std::function requires a copyable target, Global is move-only
+
+public:
+    explicit ScriptCallback(Engine& engine, Local<Function> const& function)
+    : state_(std::make_shared<State const>(&engine, function)) {}
+
+    R operator()(Args... args) const {
+        ReentrantEngineScope scope{state_->engine};
+
+        std::array<Local<Value>, sizeof...(Args)> argv{toJs(std::forward<Args>(args))...};
+
+        auto result = state_->function.get().call({}, argv);
+        if constexpr (!std::is_void_v<R>) {
+            return toCpp<R>(result); // TODO: 处理智能指针
+        }
+    }
+};
+
 template <typename R, typename... Args>
-decltype(auto) wrapScriptCallback(Local<Value> const& value) {
+std::function<R(Args...)> wrapScriptCallback(Local<Value> const& value) {
     if (!value.isFunction()) [[unlikely]] {
         throw Exception("expected function", Exception::Type::TypeError);
     }
     auto& engine = EngineScope::currentEngineChecked();
+    return ScriptCallback<R, Args...>{engine, value.asFunction()};
+}
 
-    Global<Function> global{value.asFunction()}; // keep alive
-    return [keep = std::move(global), engine = &engine](Args&&... args) -> R {
-        EngineScope lock{engine};
+template <typename T>
+inline constexpr bool IsTask_v = false;
+template <typename T>
+inline constexpr bool IsTask_v<Task<T>> = true;
 
-        auto function = keep.get();
+// a Task outlives the call whose tuple / ScratchArena hold the converted arguments, so it may only take owning
+// values (a Local by value is fine until the first co_await, see Task.h)
+template <typename Tuple>
+inline constexpr bool OwnsCoroutineArgs_v = []<typename... Args>(std::tuple<Args...>*) {
+    return ((!std::is_reference_v<Args> && !std::is_pointer_v<Args> && !ScratchConvertible<Args>) && ...);
+}(static_cast<Tuple*>(nullptr));
 
-        std::array<Value, sizeof...(Args)> argv{toJs(std::forward<Args>(args))...};
-        if constexpr (std::is_void_v<R>) {
-            function.call({}, argv);
-            return;
+// Fn may run with the engine unlocked: no Local argument or result, handles are only valid under the lock
+template <typename Fn>
+inline constexpr bool CanReleaseEngine_v = [] {
+    using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
+    return []<typename... Args>(std::tuple<Args...>*) {
+        return (!detail::ContainsLocal_v<std::remove_cvref_t<Args>> && ...);
+    }(static_cast<typename Trait::ArgsTuple*>(nullptr))
+        && !detail::ContainsLocal_v<std::remove_cvref_t<typename Trait::ReturnType>>;
+}();
+
+/**
+ * @brief Run the C++ call of a binding, with the engine unlocked if `release` (ExitEngineScope)
+ * @note arguments are converted before and the result after, both with the engine locked
+ */
+template <typename Fn, typename Call>
+decltype(auto) invokeReleasingEngine(bool release, Call&& call) {
+    if constexpr (CanReleaseEngine_v<Fn>) {
+        std::optional<ExitEngineScope> unlocked;
+        if (release) {
+            unlocked.emplace();
         }
-        return toCpp<R>(function.call({}, argv)); // TODO: 处理智能指针
-    };
+        return std::forward<Call>(call)();
+    } else {
+        assert(!release && "a binding with Local arguments or result cannot release the engine");
+        return std::forward<Call>(call)();
+    }
 }
 
 // C++ function -> JavaScript function
 template <typename Fn>
 FunctionCallback wrapFunction(Fn&& fn, ReturnValuePolicy policy) {
+    return wrapFunction(std::forward<Fn>(fn), policy, nullptr);
+}
+
+template <typename Fn>
+FunctionCallback wrapFunction(Fn&& fn, ReturnValuePolicy policy, std::shared_ptr<bool const> releaseEngine) {
     if constexpr (traits::isFunctionCallback_v<Fn>) {
         return std::forward<Fn>(fn);
     }
-    return [f = std::forward<Fn>(fn), policy](Arguments const& args) -> Local<Value> {
+    return [f = std::forward<Fn>(fn), policy, releaseEngine](Arguments const& args) -> Local<Value> {
         using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
         using R     = typename Trait::ReturnType;
         using Tuple = typename Trait::ArgsTuple;
+        static_assert(
+            !IsTask_v<std::remove_cvref_t<R>> || OwnsCoroutineArgs_v<Tuple>,
+            "coroutines must take owning arguments (std::string, std::vector), references and views would dangle"
+        );
 
         constexpr auto Count = Trait::ArgsCount;
         if (args.length() != Count) [[unlikely]] {
             throw Exception("argument count mismatch", Exception ::Type::TypeError);
         }
 
+        ScratchArena arena;
+        auto         converted = ConvertArgsToTuple<Tuple>(args, arena, std::make_index_sequence<Count>());
+        bool const   release   = releaseEngine && *releaseEngine;
         if constexpr (std::is_void_v<R>) {
-            std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<Count>()));
+            invokeReleasingEngine<Fn>(release, [&] { std::apply(f, std::move(converted)); });
             return {}; // undefined
         } else {
-            decltype(auto) ret = std::apply(f, ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<Count>()));
+            decltype(auto) ret =
+                invokeReleasingEngine<Fn>(release, [&]() -> R { return std::apply(f, std::move(converted)); });
             return toJs(ret, policy, args.hasThiz() ? args.thiz() : Local<Value>{});
         }
     };
@@ -243,7 +429,8 @@ ConstructorCallback wrapConstructor() {
 
             using Tuple = std::tuple<Args...>;
 
-            auto parameters = ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<N>());
+            ScratchArena arena;
+            auto         parameters = ConvertArgsToTuple<Tuple>(args, arena, std::make_index_sequence<N>());
             return std::apply(
                 [](auto&&... unpackedArgs) {
                     return factory::newNativeInstance<C>(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
@@ -256,13 +443,27 @@ ConstructorCallback wrapConstructor() {
 
 template <typename C, typename Fn>
 InstanceMethodCallback wrapInstanceMethod(Fn&& fn, ReturnValuePolicy policy) {
+    return wrapInstanceMethod<C>(std::forward<Fn>(fn), policy, nullptr);
+}
+
+template <typename C, typename Fn>
+InstanceMethodCallback
+wrapInstanceMethod(Fn&& fn, ReturnValuePolicy policy, std::shared_ptr<bool const> releaseEngine) {
     if constexpr (traits::isInstanceMethodCallback_v<Fn>) {
         return std::forward<Fn>(fn); // 已是标准的回调，直接转发不需要进行绑定
     }
-    return [f = std::forward<Fn>(fn), policy](InstancePayload& payload, const Arguments& args) -> Local<Value> {
+    if constexpr (InlineValueType<C>) {
+        policy = detail::inlineValuePolicy(policy); // 内联值类型在栈副本上调用，引用不能逃逸
+    }
+    return [f = std::forward<Fn>(fn), policy, releaseEngine](InstancePayload& payload, const Arguments& args)
+               -> Local<Value> {
         using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
         using R     = typename Trait::ReturnType;
         using Tuple = typename Trait::ArgsTuple;
+        static_assert(
+            !IsTask_v<std::remove_cvref_t<R>> || OwnsCoroutineArgs_v<Tuple>,
+            "coroutines must take owning arguments (std::string, std::vector), references and views would dangle"
+        );
 
         constexpr size_t ArgsCount = Trait::ArgsCount;
         if (args.length() != ArgsCount) [[unlikely]] {
@@ -275,21 +476,28 @@ InstanceMethodCallback wrapInstanceMethod(Fn&& fn, ReturnValuePolicy policy) {
             throw Exception{"Accessing destroyed instance", Exception::Type::TypeError};
         }
 
+        ScratchArena arena;
+        auto         converted = ConvertArgsToTuple<Tuple>(args, arena, std::make_index_sequence<ArgsCount>());
+        bool const   release   = releaseEngine && *releaseEngine;
         if constexpr (std::is_void_v<R>) {
-            std::apply(
-                [inst, &f](auto&&... unpackedArgs) {
-                    (inst->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
-                },
-                ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<ArgsCount>())
-            );
+            invokeReleasingEngine<Fn>(release, [&] {
+                std::apply(
+                    [inst, &f](auto&&... unpackedArgs) {
+                        (inst->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+                    },
+                    std::move(converted)
+                );
+            });
             return {}; // undefined
         } else {
-            decltype(auto) ret = std::apply(
-                [inst, &f](auto&&... unpackedArgs) -> R {
-                    return (inst->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
-                },
-                ConvertArgsToTuple<Tuple>(args, std::make_index_sequence<ArgsCount>())
-            );
+            decltype(auto) ret = invokeReleasingEngine<Fn>(release, [&]() -> R {
+                return std::apply(
+                    [inst, &f](auto&&... unpackedArgs) -> R {
+                        return (inst->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+                    },
+                    std::move(converted)
+                );
+            });
             // 特殊情况，对于 Builder 模式，返回 this
             if constexpr (std::is_same_v<R, C&>) {
                 assert(args.hasThiz() && "this is required for Builder pattern");
@@ -301,6 +509,159 @@ InstanceMethodCallback wrapInstanceMethod(Fn&& fn, ReturnValuePolicy policy) {
     };
 }
 
+// ---------------------
+// async (worker pool, see Engine::runAsync)
+// ---------------------
+
+template <typename Tuple>
+inline constexpr bool TakesCancellationToken_v = [] {
+    if constexpr (std::tuple_size_v<Tuple> == 0) {
+        return false;
+    } else {
+        using Last = std::tuple_element_t<std::tuple_size_v<Tuple> - 1, Tuple>;
+        return std::is_same_v<std::remove_cvref_t<Last>, CancellationToken>;
+    }
+}();
+
+/**
+ * @brief Convert call arguments into owning storage that can be handed to a worker thread
+ * @note no ScratchArena here, it ends with the call
+ */
+template <typename Tuple, std::size_t... Is>
+inline auto ConvertAsyncArgsToTuple(Arguments const& args, std::index_sequence<Is...>) {
+    static_assert(
+        (!ScratchConvertible<std::tuple_element_t<Is, Tuple>> && ...),
+        "async functions must take owning arguments (std::string, std::vector), views would dangle"
+    );
+    static_assert(
+        (!detail::ContainsLocal_v<std::remove_cvref_t<std::tuple_element_t<Is, Tuple>>> && ...),
+        "async functions cannot take Local arguments, they run on a worker thread outside any handle scope"
+    );
+    using SafeTuple = std::tuple<StorageType_t<std::tuple_element_t<Is, Tuple>>...>;
+    return SafeTuple{toCpp<std::tuple_element_t<Is, Tuple>>(args[Is])...};
+}
+
+// true if an argument refers to a script-owned object (native instance reference / pointer)
+template <typename Tuple, std::size_t... Is>
+constexpr bool BorrowsAsyncArgs(std::index_sequence<Is...>) {
+    return (
+        (std::is_reference_v<StorageType_t<std::tuple_element_t<Is, Tuple>>>
+         || std::is_pointer_v<StorageType_t<std::tuple_element_t<Is, Tuple>>>)
+        || ...
+    );
+}
+
+// `this` (and the arguments, if borrowed) stay alive until the call settles
+inline Local<Value> asyncKeepAlive(Arguments const& args, bool withArgs) {
+    std::vector<Local<Value>> values;
+    if (args.hasThiz()) {
+        values.push_back(args.thiz());
+    }
+    for (size_t i = 0; withArgs && i < args.length(); ++i) {
+        values.push_back(args[i]);
+    }
+    if (values.empty()) {
+        return {};
+    }
+    return Array::newArray(values);
+}
+
+template <typename R, typename Call>
+Local<Value> startAsyncCall(Call&& call, Local<Value> const& keepAlive) {
+    static_assert(
+        !detail::ContainsLocal_v<std::remove_cvref_t<R>>,
+        "async functions cannot return a Local, return a C++ value that is converted on the engine thread"
+    );
+    auto& engine = EngineScope::currentEngineChecked();
+    auto  shared = std::make_shared<std::decay_t<Call>>(std::forward<Call>(call)); // AsyncWork must be copyable
+    return engine.runAsync(
+        [shared](CancellationToken const& token) -> std::function<Local<Value>()> {
+            if constexpr (std::is_void_v<R>) {
+                (*shared)(token);
+                return [] { return Local<Value>{}; };
+            } else {
+                auto result = std::make_shared<std::decay_t<R>>((*shared)(token));
+                return [result] { return toJs(std::move(*result)); }; // on the engine thread
+            }
+        },
+        keepAlive
+    );
+}
+
+template <typename Fn>
+FunctionCallback wrapAsyncFunction(Fn&& fn) {
+    return [f = std::forward<Fn>(fn)](Arguments const& args) -> Local<Value> {
+        using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
+        using R     = typename Trait::ReturnType;
+        using Tuple = typename Trait::ArgsTuple;
+
+        constexpr bool   WithToken = TakesCancellationToken_v<Tuple>;
+        constexpr size_t Count     = Trait::ArgsCount - (WithToken ? 1 : 0);
+        if (args.length() != Count) [[unlikely]] {
+            throw Exception("argument count mismatch", Exception::Type::TypeError);
+        }
+
+        auto converted = ConvertAsyncArgsToTuple<Tuple>(args, std::make_index_sequence<Count>());
+        auto keepAlive = asyncKeepAlive(args, BorrowsAsyncArgs<Tuple>(std::make_index_sequence<Count>()));
+        return startAsyncCall<R>(
+            [f, converted = std::move(converted)](CancellationToken const& token) mutable -> R {
+                return std::apply(
+                    [&](auto&&... unpackedArgs) -> R {
+                        if constexpr (WithToken) {
+                            return f(std::forward<decltype(unpackedArgs)>(unpackedArgs)..., token);
+                        } else {
+                            return f(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+                        }
+                    },
+                    std::move(converted)
+                );
+            },
+            keepAlive
+        );
+    };
+}
+
+template <typename C, typename Fn>
+InstanceMethodCallback wrapAsyncInstanceMethod(Fn&& fn) {
+    static_assert(!InlineValueType<C>, "inline value classes cannot have async methods, they run on a stack copy");
+    return [f = std::forward<Fn>(fn)](InstancePayload& payload, Arguments const& args) -> Local<Value> {
+        using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
+        using R     = typename Trait::ReturnType;
+        using Tuple = typename Trait::ArgsTuple;
+
+        constexpr bool   WithToken = TakesCancellationToken_v<Tuple>;
+        constexpr size_t Count     = Trait::ArgsCount - (WithToken ? 1 : 0);
+        if (args.length() != Count) [[unlikely]] {
+            throw Exception("argument count mismatch", Exception::Type::TypeError);
+        }
+
+        using UnwrapC = std::conditional_t<Trait::isConst, const C, C>;
+        UnwrapC* inst = payload.unwrap<UnwrapC>();
+        if (!inst) {
+            throw Exception{"Accessing destroyed instance", Exception::Type::TypeError};
+        }
+
+        auto converted = ConvertAsyncArgsToTuple<Tuple>(args, std::make_index_sequence<Count>());
+        auto keepAlive = asyncKeepAlive(args, BorrowsAsyncArgs<Tuple>(std::make_index_sequence<Count>()));
+        return startAsyncCall<R>(
+            [f, inst, converted = std::move(converted)](CancellationToken const& token) mutable -> R {
+                return std::apply(
+                    [&](auto&&... unpackedArgs) -> R {
+                        if constexpr (WithToken) {
+                            return (inst->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)..., token);
+                        } else {
+                            return (inst->*f)(std::forward<decltype(unpackedArgs)>(unpackedArgs)...);
+                        }
+                    },
+                    std::move(converted)
+                );
+            },
+            keepAlive
+        );
+    };
+}
+
+
 template <size_t Len>
 inline InstanceMethodCallback _mergeMethodCallbacks(std::array<InstanceMethodCallback, Len> overloads) {
     return [fs = std::move(overloads)](InstancePayload& payload, Arguments const& args) -> Local<Value> {
@@ -345,6 +706,83 @@ InstanceMethodCallback wrapOverloadMethodAndExtraPolicy(Overload&&... fn) {
 }
 
 
+// C++ instance Getter / Setter -> JavaScript accessor property
+template <typename C, typename Fn>
+InstanceGetterCallback wrapInstanceGetter(Fn&& getter, ReturnValuePolicy policy) {
+    if constexpr (traits::isInstanceGetterCallback_v<Fn>) {
+        return std::forward<Fn>(getter);
+    }
+    if constexpr (InlineValueType<C>) {
+        policy = detail::inlineValuePolicy(policy);
+    }
+    return [get = std::forward<Fn>(getter), policy](InstancePayload& payload, Arguments const& args) -> Local<Value> {
+        using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
+        static_assert(!std::is_void_v<typename Trait::ReturnType>, "Getter must return a value");
+        static_assert(Trait::ArgsCount == 0, "Getter must not take arguments");
+
+        using UnwrapC = std::conditional_t<Trait::isConst, const C, C>;
+        UnwrapC* inst = payload.unwrap<UnwrapC>();
+        if (!inst) {
+            throw Exception{"Accessing destroyed instance", Exception::Type::TypeError};
+        }
+        decltype(auto) value = std::invoke(get, inst);
+        return toJs(value, policy, args.hasThiz() ? args.thiz() : Local<Value>{});
+    };
+}
+
+template <typename C, typename Fn>
+InstanceSetterCallback wrapInstanceSetter(Fn&& setter) {
+    if constexpr (traits::isInstanceSetterCallback_v<Fn>) {
+        return std::forward<Fn>(setter);
+    }
+    return [set = std::forward<Fn>(setter)](InstancePayload& payload, Local<Value> const& value) -> void {
+        using Trait = traits::FunctionTraits<std::decay_t<Fn>>;
+        static_assert(std::is_void_v<typename Trait::ReturnType>, "Setter must not return a value");
+        static_assert(Trait::ArgsCount == 1, "Setter must take one argument");
+
+        C* inst = payload.unwrap<C>();
+        if (!inst) {
+            throw Exception{"Accessing destroyed instance", Exception::Type::TypeError};
+        }
+        using Type = std::tuple_element_t<0, typename Trait::ArgsTuple>;
+        std::invoke(set, inst, toCpp<Type>(value));
+    };
+}
+
+template <typename C, bool forceReadonly, typename M, typename Owner>
+std::pair<InstanceGetterCallback, InstanceSetterCallback>
+wrapInstanceMember(M Owner::* member, ReturnValuePolicy policy) {
+    static_assert(std::is_base_of_v<Owner, C>, "Member does not belong to the bound class");
+
+    // like a member reference: the returned wrapper keeps the owning instance alive
+    if (policy == ReturnValuePolicy::kAutomatic) {
+        policy = ReturnValuePolicy::kReferenceInternal;
+    }
+    if constexpr (InlineValueType<C>) {
+        policy = detail::inlineValuePolicy(policy);
+    }
+
+    InstanceGetterCallback getter = [member, policy](InstancePayload& payload, Arguments const& args) -> Local<Value> {
+        C const* inst = payload.unwrap<C const>();
+        if (!inst) {
+            throw Exception{"Accessing destroyed instance", Exception::Type::TypeError};
+        }
+        return toJs(inst->*member, policy, args.hasThiz() ? args.thiz() : Local<Value>{});
+    };
+    InstanceSetterCallback setter = nullptr;
+    if constexpr (!std::is_const_v<M> && !forceReadonly) {
+        setter = [member](InstancePayload& payload, Local<Value> const& value) {
+            C* inst = payload.unwrap<C>();
+            if (!inst) {
+                throw Exception{"Accessing destroyed instance", Exception::Type::TypeError};
+            }
+            inst->*member = toCpp<M const&>(value);
+        };
+    }
+    return {std::move(getter), std::move(setter)};
+}
+
+
 template <typename C>
 InstanceMemberMeta::InstanceEqualsCallback bindInstanceEqualsImpl(std::false_type) {
     return [](void* lhs, void* rhs) -> bool { return lhs == rhs; };
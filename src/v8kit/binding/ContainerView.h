@@ -0,0 +1,70 @@
+#pragma once
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace v8kit::binding {
+
+/**
+ * @brief Live view of a std::vector, converted to an array-like object that reads/writes the vector in place
+ * @note Writing index == length appends. VectorView<T const> is read-only.
+ * @note The view does not own the vector: return it from a bound method so the instance is kept alive
+ *       (the `this` object becomes the owner of the view).
+ *
+ * @example
+ * class Inventory {
+ *     std::vector<int> items_;
+ * public:
+ *     VectorView<int> items() { return VectorView{items_}; }
+ * };
+ */
+template <typename T>
+class VectorView {
+public:
+    using Container =
+        std::conditional_t<std::is_const_v<T>, std::vector<std::remove_const_t<T>> const, std::vector<T>>;
+
+    explicit VectorView(Container& container) : container_(&container) {}
+
+    [[nodiscard]] Container& container() const { return *container_; }
+
+private:
+    Container* container_;
+};
+
+template <typename T>
+VectorView(std::vector<T>&) -> VectorView<T>;
+template <typename T>
+VectorView(std::vector<T> const&) -> VectorView<T const>;
+
+
+/**
+ * @brief Live view of a string-keyed map, converted to an object whose properties are the map entries
+ * @note `in`, delete, Object.keys/entries and for-in go through the map. MapView<K, V const> is read-only.
+ * @tparam M std::unordered_map<K, V> / std::map<K, V> (V without const)
+ */
+template <typename K, typename V, typename M = std::unordered_map<K, std::remove_const_t<V>>>
+class MapView {
+    static_assert(
+        std::is_convertible_v<K const&, std::string_view>,
+        "MapView keys must be strings, other key types are not reachable through named properties"
+    );
+
+public:
+    using Container = std::conditional_t<std::is_const_v<V>, M const, M>;
+
+    explicit MapView(Container& container) : container_(&container) {}
+
+    [[nodiscard]] Container& container() const { return *container_; }
+
+private:
+    Container* container_;
+};
+
+template <template <typename...> typename Map, typename K, typename V, typename... Rest>
+MapView(Map<K, V, Rest...>&) -> MapView<K, V, Map<K, V, Rest...>>;
+template <template <typename...> typename Map, typename K, typename V, typename... Rest>
+MapView(Map<K, V, Rest...> const&) -> MapView<K, V const, Map<K, V, Rest...>>;
+
+} // namespace v8kit::binding
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <utility>
+
+namespace v8kit::binding {
+
+/**
+ * @brief A C++ range handed to scripts as a lazy iterable (see Engine::newIterator)
+ * @note Elements are converted one `next()` at a time, or `chunk` elements per `next()` (each value is then an array).
+ *       A script that stops early never touches the rest of the range.
+ * @note A range that refers to a member (lvalue container / ref_view) stays valid as long as the object that
+ *       returned it, which the iterator keeps alive.
+ */
+template <std::ranges::input_range R>
+class LazyRange {
+public:
+    explicit LazyRange(R range, size_t chunk = 0) : range_(std::make_shared<R>(std::move(range))), chunk_(chunk) {}
+
+    [[nodiscard]] std::shared_ptr<R> const& range() const { return range_; }
+
+    [[nodiscard]] size_t chunk() const { return chunk_; }
+
+private:
+    std::shared_ptr<R> range_; // shared, because converters receive the returned value as an lvalue
+    size_t             chunk_;
+};
+
+/**
+ * @example
+ * auto Db::rows() { return lazy(rows_ | std::views::filter(&Row::visible)); }
+ * for (const row of db.rows()) { if (...) break; }
+ */
+template <std::ranges::viewable_range R>
+[[nodiscard]] auto lazy(R&& range) {
+    return LazyRange<std::views::all_t<R>>{std::views::all(std::forward<R>(range))};
+}
+
+template <std::input_iterator I, std::sentinel_for<I> S>
+[[nodiscard]] auto lazy(I first, S last) {
+    return LazyRange<std::ranges::subrange<I, S>>{std::ranges::subrange<I, S>{std::move(first), std::move(last)}};
+}
+
+/**
+ * @brief Like lazy(), but each `next()` yields an array of up to `chunk` elements (fewer boundary crossings)
+ */
+template <std::ranges::viewable_range R>
+[[nodiscard]] auto chunked(R&& range, size_t chunk) {
+    return LazyRange<std::views::all_t<R>>{std::views::all(std::forward<R>(range)), chunk == 0 ? 1 : chunk};
+}
+
+} // namespace v8kit::binding
@@ -1,11 +1,13 @@
 #pragma once
 #include "Adapter.h"
+#include "Reflection.h"
 #include "ReturnValuePolicy.h"
 #include "traits/FunctionTraits.h"
 #include "v8kit/binding/traits/TypeTraits.h"
 #include "v8kit/core/Concepts.h"
 #include "v8kit/core/MetaInfo.h"
 
+#include <memory>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -36,7 +38,10 @@ class ClassMetaBuilder {
 
     ClassMeta::UpcasterCallback upcaster_ = nullptr;
 
+    std::shared_ptr<bool> releaseEngine_ = nullptr; // flag of the preceding func / method, reset by other calls
+
     static constexpr bool isInstanceClass = !std::is_void_v<T>;
+    static constexpr bool isInlineValue   = InlineValueType<T>;
 
     template <ConstructorKind OtherState>
     explicit ClassMetaBuilder(ClassMetaBuilder<T, OtherState>&& other) noexcept
@@ -48,7 +53,8 @@ class ClassMetaBuilder {
       base_(other.base_),
       userDefinedConstructor_(std::move(other.userDefinedConstructor_)),
       constructors_(std::move(other.constructors_)),
-      upcaster_(other.upcaster_) {
+      upcaster_(other.upcaster_),
+      releaseEngine_(std::move(other.releaseEngine_)) {
         // note: other may be in moved-from state
     }
 
@@ -88,6 +94,7 @@ public:
 
     auto& func(std::string name, FunctionCallback fn) {
         staticFunctions_.emplace_back(std::move(name), std::move(fn));
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -95,7 +102,8 @@ public:
     auto& func(std::string name, Fn&& fn, ReturnValuePolicy policy = ReturnValuePolicy::kAutomatic)
         requires(!traits::isFunctionCallback_v<Fn>)
     {
-        auto f = adapter::wrapFunction(std::forward<Fn>(fn), policy);
+        releaseEngine_ = adapter::CanReleaseEngine_v<Fn> ? std::make_shared<bool>(false) : nullptr;
+        auto f         = adapter::wrapFunction(std::forward<Fn>(fn), policy, releaseEngine_);
         staticFunctions_.emplace_back(std::move(name), std::move(f));
         return *this;
     }
@@ -106,11 +114,41 @@ public:
     {
         auto f = adapter::wrapOverloadFuncAndExtraPolicy(std::forward<Fn>(fn)...);
         staticFunctions_.emplace_back(std::move(name), std::move(f));
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    // runs on the engine's worker pool, scripts receive a Promise (see Engine::runAsync)
+    template <typename Fn>
+    auto& func_async(std::string name, Fn&& fn) {
+        staticFunctions_.emplace_back(std::move(name), adapter::wrapAsyncFunction(std::forward<Fn>(fn)));
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    /**
+     * @brief Unlock the engine (ExitEngineScope) while the C++ side of the last func / method runs,
+     *        so other threads can enter it. Arguments and the result are still converted under the lock.
+     * @note only for single (non overloaded, non raw callback) bindings without Local arguments or result, and
+     *       only right after them; the function must not touch the engine, and pointer / reference arguments into
+     *       script objects are only safe if no other thread mutates them.
+     *
+     * @example
+     * .func("compress", &zlibCompress).releases_engine()
+     */
+    auto& releases_engine() {
+        if (!releaseEngine_) {
+            throw std::logic_error(
+                "releases_engine() must directly follow a single func / method binding without Local handles"
+            );
+        }
+        *releaseEngine_ = true;
         return *this;
     }
 
     auto& var(std::string name, GetterCallback getter, SetterCallback setter) {
         staticProperty_.emplace_back(std::move(name), std::move(getter), std::move(setter));
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -121,6 +159,7 @@ public:
         auto g = adapter::wrapGetter(std::forward<G>(getter), policy);
         auto s = adapter::wrapSetter(std::forward<S>(setter));
         staticProperty_.emplace_back(std::move(name), std::move(g), std::move(s));
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -130,6 +169,7 @@ public:
     {
         auto [g, s] = adapter::wrapStaticMember(std::forward<Ty>(value), policy);
         staticProperty_.emplace_back(std::move(name), std::move(g), std::move(s));
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -139,6 +179,7 @@ public:
     {
         auto [g, s] = adapter::wrapStaticMember<Ty, true>(std::forward<Ty>(value), policy);
         staticProperty_.emplace_back(std::move(name), std::move(g), std::move(s));
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -151,6 +192,7 @@ public:
         } else {
             auto get = adapter::wrapGetter(std::forward<G>(getter), policy);
             staticProperty_.emplace_back(std::move(name), std::move(get), nullptr);
+            releaseEngine_ = nullptr;
             return *this;
         }
     }
@@ -164,6 +206,7 @@ public:
         requires(isInstanceClass && K == ConstructorKind::kNone)
     {
         userDefinedConstructor_ = [](Arguments const&) { return nullptr; };
+        releaseEngine_          = nullptr;
         ClassMetaBuilder<T, ConstructorKind::kDisabled> builder{std::move(*this)};
         return builder; // NRVO/move
     }
@@ -172,6 +215,7 @@ public:
         requires(isInstanceClass && K == ConstructorKind::kNone)
     {
         userDefinedConstructor_ = std::move(fn);
+        releaseEngine_          = nullptr;
         ClassMetaBuilder<T, ConstructorKind::kCustom> builder{std::move(*this)};
         return builder; // NRVO/move
     }
@@ -185,6 +229,7 @@ public:
 
         auto fn = adapter::wrapConstructor<T, Args...>();
         constructors_.emplace_back(std::move(fn));
+        releaseEngine_ = nullptr;
 
         if constexpr (K == ConstructorKind::kNormal) {
             return *this;
@@ -209,6 +254,7 @@ public:
             throw std::invalid_argument("base class has no constructor");
         }
         static_assert(std::is_base_of_v<P, T>, "Illegal inheritance relationship");
+        static_assert(!isInlineValue && !InlineValueType<P>, "Inline value classes cannot take part in inheritance");
         static_assert(!std::is_same_v<P, T>, "Identity inheritance is not allowed. Use multiple .ctor() calls.");
 
         base_     = &meta;
@@ -217,6 +263,7 @@ public:
             P* base    = static_cast<P*>(derived);
             return base;
         };
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -225,6 +272,7 @@ public:
         requires isInstanceClass
     {
         instanceFunctions_.emplace_back(std::move(name), std::move(fn));
+        releaseEngine_ = nullptr;
         return *this;
     }
 
@@ -232,7 +280,8 @@ public:
     auto& method(std::string name, Fn&& fn, ReturnValuePolicy policy = ReturnValuePolicy::kAutomatic)
         requires isInstanceClass
     {
-        auto f = adapter::wrapInstanceMethod<T>(std::forward<Fn>(fn), policy);
+        releaseEngine_ = adapter::CanReleaseEngine_v<Fn> ? std::make_shared<bool>(false) : nullptr;
+        auto f         = adapter::wrapInstanceMethod<T>(std::forward<Fn>(fn), policy, releaseEngine_);
         instanceFunctions_.emplace_back(std::move(name), std::move(f));
         return *this;
     }
@@ -243,11 +292,78 @@ public:
     {
         auto f = adapter::wrapOverloadMethodAndExtraPolicy<T>(std::forward<Fn>(fn)...);
         instanceFunctions_.emplace_back(std::move(name), std::move(f));
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    // runs on the engine's worker pool, scripts receive a Promise; the instance is shared with the worker thread
+    template <typename Fn>
+    auto& method_async(std::string name, Fn&& fn)
+        requires isInstanceClass
+    {
+        instanceFunctions_.emplace_back(std::move(name), adapter::wrapAsyncInstanceMethod<T>(std::forward<Fn>(fn)));
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    auto& prop(std::string name, InstanceGetterCallback getter, InstanceSetterCallback setter)
+        requires isInstanceClass
+    {
+        instanceProperty_.emplace_back(std::move(name), std::move(getter), std::move(setter));
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    // getter / setter member functions (setter may be nullptr)
+    template <typename G, typename S>
+    auto& prop(std::string name, G&& getter, S&& setter, ReturnValuePolicy policy = ReturnValuePolicy::kAutomatic)
+        requires(
+            isInstanceClass && !traits::isInstanceGetterCallback_v<G>
+            && !std::is_member_object_pointer_v<std::remove_cvref_t<G>>
+            && (!traits::isInstanceSetterCallback_v<S> || std::is_null_pointer_v<std::remove_cvref_t<S>>)
+        )
+    {
+        auto g = adapter::wrapInstanceGetter<T>(std::forward<G>(getter), policy);
+        if constexpr (std::is_null_pointer_v<std::remove_cvref_t<S>>) {
+            instanceProperty_.emplace_back(std::move(name), std::move(g), nullptr);
+        } else {
+            auto s = adapter::wrapInstanceSetter<T>(std::forward<S>(setter));
+            instanceProperty_.emplace_back(std::move(name), std::move(g), std::move(s));
+        }
+        releaseEngine_ = nullptr;
         return *this;
     }
 
-    // prop
-    // prop_readonly
+    // data member, the getter defaults to ReturnValuePolicy::kReferenceInternal
+    template <typename M, typename Owner>
+    auto& prop(std::string name, M Owner::* member, ReturnValuePolicy policy = ReturnValuePolicy::kAutomatic)
+        requires(isInstanceClass && !std::is_function_v<M>)
+    {
+        auto [g, s] = adapter::wrapInstanceMember<T>(member, policy);
+        instanceProperty_.emplace_back(std::move(name), std::move(g), std::move(s));
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    template <typename M, typename Owner>
+    auto& prop_readonly(std::string name, M Owner::* member, ReturnValuePolicy policy = ReturnValuePolicy::kAutomatic)
+        requires(isInstanceClass && !std::is_function_v<M>)
+    {
+        auto [g, s] = adapter::wrapInstanceMember<T, true>(member, policy);
+        instanceProperty_.emplace_back(std::move(name), std::move(g), nullptr);
+        releaseEngine_ = nullptr;
+        return *this;
+    }
+
+    template <typename G>
+    auto& prop_readonly(std::string name, G&& getter, ReturnValuePolicy policy = ReturnValuePolicy::kAutomatic)
+        requires(isInstanceClass && std::is_member_function_pointer_v<std::remove_cvref_t<G>>)
+    {
+        auto g = adapter::wrapInstanceGetter<T>(std::forward<G>(getter), policy);
+        instanceProperty_.emplace_back(std::move(name), std::move(g), nullptr);
+        releaseEngine_ = nullptr;
+        return *this;
+    }
 
     [[nodiscard]] ClassMeta build() {
         ConstructorCallback constructorCallback = nullptr;
@@ -303,7 +419,8 @@ public:
                              std::move(instanceFunctions_),
                              traits::size_of_v<T>,
                              equalsCallback, copyCloneCtor,
-                             moveCloneCtor
+                             moveCloneCtor,
+                             isInlineValue ? traits::size_of_v<T> : 0
             },
             base_,
             std::type_index{typeid(T)},
@@ -318,6 +435,7 @@ template <typename T>
 class EnumMetaBuilder {
     std::string                  name_;
     std::vector<EnumMeta::Entry> entries_;
+    bool                         stringValues_{false};
 
 public:
     explicit EnumMetaBuilder(std::string_view name) : name_{name} {}
@@ -327,7 +445,15 @@ public:
         return *this;
     }
 
-    [[nodiscard]] EnumMeta build() { return EnumMeta{std::move(name_), std::move(entries_)}; }
+    /**
+     * @brief Expose the entries as their name strings instead of numbers (see StringEnum)
+     */
+    EnumMetaBuilder& stringValues() {
+        stringValues_ = true;
+        return *this;
+    }
+
+    [[nodiscard]] EnumMeta build() { return EnumMeta{std::move(name_), std::move(entries_), stringValues_}; }
 };
 
 
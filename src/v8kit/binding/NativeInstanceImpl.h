@@ -59,7 +59,7 @@ public:
 
     std::shared_ptr<void> get_shared_ptr() const override {
         if constexpr (traits::is_shared_ptr_v<Holder>) {
-            return value_;
+            return std::const_pointer_cast<std::remove_const_t<ElementType>>(value_);
         }
         return nullptr;
     }
@@ -80,6 +80,17 @@ public:
 
     bool is_owned() const override { return traits::is_unique_ptr_v<Holder>; }
 
+    std::unique_ptr<NativeInstance> to_shared() override {
+        if constexpr (traits::is_unique_ptr_v<Holder>) {
+            return std::make_unique<NativeInstanceImpl<T, std::shared_ptr<ElementType>>>(
+                meta_,
+                std::shared_ptr<ElementType>{std::move(value_)},
+                most_derived_ptr_
+            );
+        }
+        return nullptr;
+    }
+
 private:
     ElementType* get_raw_ptr() const {
         if constexpr (std::is_pointer_v<Holder>) {
@@ -91,6 +102,73 @@ private:
 };
 
 
+/**
+ * @brief ReturnValuePolicy::kCopyOnWrite 的实例持有者
+ * 共享源对象（由 JS 父实例保活），首次可变 unwrap 时复制出私有副本并转为独占持有
+ *
+ * @tparam T 源对象类型，可为 const (此时与 kCopy 一样只读，永远不会复制)
+ */
+template <typename T>
+class CopyOnWriteInstance final : public NativeInstance {
+    static_assert(std::is_copy_constructible_v<T>, "CopyOnWriteInstance requires a copy constructible type");
+
+public:
+    using ElementType = T;
+    using ValueType   = std::remove_const_t<T>;
+
+    explicit CopyOnWriteInstance(ClassMeta const* meta, T* shared) : NativeInstance(meta), shared_(shared) {}
+
+    ~CopyOnWriteInstance() override = default;
+
+    std::type_index type_id() const override { return std::type_index(typeid(ValueType)); }
+
+    bool is_const() const override { return std::is_const_v<T>; }
+
+    void* cast(std::type_index target_type) const override {
+        void* self = const_cast<ValueType*>(current());
+        if (target_type == std::type_index(typeid(ValueType))) {
+            return self;
+        }
+        if (meta_) {
+            return meta_->castTo(self, target_type);
+        }
+        return nullptr;
+    }
+
+    std::unique_ptr<NativeInstance> clone() const override {
+        auto  copy = std::make_unique<T>(*current());
+        void* raw  = const_cast<ValueType*>(copy.get());
+        return std::make_unique<NativeInstanceImpl<T, std::unique_ptr<T>>>(meta_, std::move(copy), raw);
+    }
+
+    bool is_owned() const override { return owned_ != nullptr; }
+
+    void ensure_writable() const override {
+        if (!owned_) {
+            owned_ = std::make_unique<ValueType>(*shared_);
+        }
+    }
+
+    std::unique_ptr<NativeInstance> to_shared() override {
+        ensure_writable(); // the shared owner must not depend on the parent
+        void* raw = owned_.get();
+        return std::make_unique<NativeInstanceImpl<ValueType, std::shared_ptr<ValueType>>>(
+            meta_,
+            std::shared_ptr<ValueType>{std::move(owned_)},
+            raw
+        );
+    }
+
+    [[nodiscard]] bool is_detached() const { return owned_ != nullptr; }
+
+private:
+    [[nodiscard]] ValueType const* current() const { return owned_ ? owned_.get() : shared_; }
+
+    T*                                 shared_; // valid while the parent instance is alive
+    mutable std::unique_ptr<ValueType> owned_;  // private copy after the first write
+};
+
+
 namespace traits::detail {
 // 专门用于提取 裸指针、值、以及智能指针的底层元素类型
 template <typename U>
@@ -207,6 +285,17 @@ createNativeInstance(T&& value, ReturnValuePolicy policy, traits::detail::Resolv
                 throw Exception("Cannot take ownership of non-pointer");
             }
 
+        case ReturnValuePolicy::kCopyOnWrite:
+            // 多态下转型需要动态类型的克隆，不走共享，直接复制 (kCopy)
+            if (resolved.is_downcasted) {
+                return createNativeInstance(std::forward<T>(value), ReturnValuePolicy::kCopy, resolved);
+            }
+            if constexpr (std::is_copy_constructible_v<ElementType>) {
+                return std::make_unique<CopyOnWriteInstance<ElementType>>(resolved.meta, rawPtr);
+            } else {
+                throw Exception("Object is not copy constructible");
+            }
+
         case ReturnValuePolicy::kReference:
         case ReturnValuePolicy::kReferenceInternal:
             // 引用持有裸指针 (takeOwnership = false)
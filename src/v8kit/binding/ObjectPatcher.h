@@ -0,0 +1,141 @@
+#pragma once
+#include "Reflection.h"
+#include "TypeConverter.h"
+#include "v8kit/core/Engine.h"
+#include "v8kit/core/EngineScope.h"
+#include "v8kit/core/Reference.h"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace v8kit::binding {
+
+/**
+ * @brief Keeps a script object in sync with a reflected struct, writing only the fields that changed
+ * @note The patcher keeps a shadow of the last pushed value of every field and the JS value it was written as:
+ *       push() diffs the state against the shadow, pull() diffs the object against the written values.
+ * @note Script edits are detected per field by identity: re-assigning `obj.hp` is seen, mutating a nested object
+ *       in place (`obj.tags.push(1)`) is not. Fields without operator== are written on every push.
+ * @note Holds a Global handle, so it must not outlive its engine.
+ *
+ * @example
+ * ObjectPatcher<PlayerState> patcher{state}; // creates the script object
+ * engine.globalThis().set("player"_key, patcher.object());
+ * // every tick
+ * patcher.pull(state); // apply what scripts changed
+ * patcher.push(state); // send what C++ changed
+ */
+template <typename T>
+    requires Reflected<T>
+class ObjectPatcher {
+public:
+    static constexpr size_t kFieldCount = std::tuple_size_v<std::remove_cvref_t<decltype(Reflect<T>::fields)>>;
+
+    /**
+     * @brief Create the script object from `initial` (requires an EngineScope), all fields start in sync
+     */
+    explicit ObjectPatcher(T const& initial) : shadow_(initial) {
+        auto&       engine = EngineScope::currentEngineChecked();
+        auto const& shape  = detail::shapeOf<T>();
+
+        std::array<Local<Value>, kFieldCount> values;
+        forEachField([&](size_t index, auto const& field) {
+            values[index] = binding::toJs(initial.*(field.member_));
+            written_[index].reset(values[index]);
+        });
+        object_.reset(engine.newObject(shape, values));
+    }
+
+    /**
+     * @brief Patch an existing object (requires an EngineScope), the first push() writes every field
+     */
+    explicit ObjectPatcher(Local<Object> const& target) : object_(target) {}
+
+    [[nodiscard]] Local<Object> object() const { return object_.get(); }
+
+    /**
+     * @brief Write the fields of `state` that changed since the last push, in one batch with cached keys
+     * @return number of fields written
+     */
+    size_t push(T const& state) {
+        auto&       engine = EngineScope::currentEngineChecked();
+        auto const& shape  = detail::shapeOf<T>();
+
+        std::vector<Local<String>> keys;
+        std::vector<Local<Value>>  values;
+        forEachField([&](size_t index, auto const& field) {
+            using Member       = typename std::remove_cvref_t<decltype(field)>::Member;
+            auto const& member = state.*(field.member_);
+            if (shadow_) {
+                if constexpr (std::equality_comparable<Member>) {
+                    if ((*shadow_).*(field.member_) == member) return;
+                }
+                (*shadow_).*(field.member_) = member;
+            }
+            keys.push_back(engine.shapeKey(shape, index));
+            values.push_back(binding::toJs(member));
+            written_[index].reset(values.back());
+        });
+        if (!shadow_) {
+            shadow_ = state;
+        }
+        if (!keys.empty()) {
+            object_.get().setMany(keys, values);
+        }
+        return keys.size();
+    }
+
+    /**
+     * @brief Copy the fields scripts re-assigned since the last push / pull into `state`
+     * @note all fields are read in one batch, only the modified ones are converted
+     * @return names of the modified fields, in declaration order
+     */
+    std::vector<std::string_view> pull(T& state) {
+        auto&       engine = EngineScope::currentEngineChecked();
+        auto const& shape  = detail::shapeOf<T>();
+
+        auto keys = [&]<size_t... I>(std::index_sequence<I...>) {
+            return std::array<Local<String>, kFieldCount>{engine.shapeKey(shape, I)...};
+        }(std::make_index_sequence<kFieldCount>{});
+        std::array<Local<Value>, kFieldCount> current;
+        object_.get().getMany(keys, current);
+
+        std::vector<std::string_view> modified;
+        forEachField([&](size_t index, auto const& field) {
+            using Member = typename std::remove_cvref_t<decltype(field)>::Member;
+            if (!written_[index].isEmpty() && written_[index].get() == current[index]) {
+                return;
+            }
+            state.*(field.member_) = binding::toCpp<Member>(current[index]);
+            if (shadow_) {
+                (*shadow_).*(field.member_) = state.*(field.member_);
+            }
+            written_[index].reset(current[index]);
+            modified.push_back(field.name_);
+        });
+        if (!shadow_) {
+            shadow_ = state;
+        }
+        return modified;
+    }
+
+private:
+    template <typename Fn>
+    static void forEachField(Fn&& fn) {
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (fn(I, std::get<I>(Reflect<T>::fields)), ...);
+        }(std::make_index_sequence<kFieldCount>{});
+    }
+
+    Global<Object>                         object_;
+    std::optional<T>                       shadow_;  // last pushed / pulled state
+    std::array<Global<Value>, kFieldCount> written_; // JS value of each field as of the last push / pull
+};
+
+} // namespace v8kit::binding
@@ -0,0 +1,116 @@
+#pragma once
+#include "v8kit/core/MetaInfo.h"
+
+#include <concepts>
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace v8kit::binding {
+
+/**
+ * @brief Field list of a plain data struct, used by TypeConverter to generate toJs/toCpp
+ * @note Specialize it with a `static constexpr auto fields = std::make_tuple(field(...), ...)` member,
+ *       or use V8KIT_REFLECT(TYPE, field("x", &TYPE::x), ...) at global namespace scope.
+ *
+ * @example
+ * struct Point { int x; int y; };
+ * V8KIT_REFLECT(Point, field("x", &Point::x), field("y", &Point::y));
+ */
+template <typename T>
+struct Reflect;
+
+template <typename C, typename M>
+struct Field {
+    using Class  = C;
+    using Member = M;
+
+    std::string_view name_;
+    M C::*           member_;
+};
+
+template <typename C, typename M>
+[[nodiscard]] constexpr Field<C, M> field(std::string_view name, M C::* member) {
+    return Field<C, M>{name, member};
+}
+
+template <typename T>
+concept Reflected = requires { Reflect<T>::fields; };
+
+/**
+ * @brief Opt an enum into string conversion: TypeConverter<T> then maps it to/from the entry names of an EnumMeta
+ * @note Specialize it with a `static EnumMeta const& meta()` member, or use V8KIT_STRING_ENUM(TYPE, META) at global
+ *       namespace scope. Build the meta with `.stringValues()` so that registerEnum exposes the same strings.
+ *
+ * @example
+ * enum class Level { Info, Warning };
+ * inline EnumMeta const LevelMeta =
+ *     defEnum<Level>("Level").value("info", Level::Info).value("warning", Level::Warning).stringValues().build();
+ * V8KIT_STRING_ENUM(Level, LevelMeta);
+ */
+template <typename T>
+struct StringEnum;
+
+template <typename T>
+concept StringMappedEnum = std::is_enum_v<T> && requires {
+    { StringEnum<T>::meta() } -> std::same_as<EnumMeta const&>;
+};
+
+/**
+ * @brief Opt a small trivially copyable class into value mode: its wrappers hold a copy of the bytes in their
+ *        internal fields instead of a heap instance (no allocation, no finalizer, see Engine::newInlineValue)
+ * @note The class is still bound with defClass<T>(); methods run on a copy that is written back when they return,
+ *       so references into the value cannot escape (reference policies fall back to kCopy) and `T&` parameters are
+ *       not supported. Inline value classes cannot take part in inheritance.
+ *
+ * @example
+ * struct Vec3 { float x, y, z; ... };
+ * V8KIT_INLINE_VALUE(Vec3);
+ */
+template <typename T>
+struct InlineValue : std::false_type {};
+
+template <typename T>
+concept InlineValueType = InlineValue<std::remove_cv_t<T>>::value;
+
+namespace detail {
+
+/**
+ * @brief Shape of a reflected struct, one instance per T (engines cache templates/keys by its address)
+ */
+template <typename T>
+    requires Reflected<T>
+ShapeMeta const& shapeOf() {
+    static ShapeMeta const shape{std::apply(
+        [](auto const&... fields) { return std::vector<std::string>{std::string{fields.name_}...}; },
+        Reflect<T>::fields
+    )};
+    return shape;
+}
+
+} // namespace detail
+
+} // namespace v8kit::binding
+
+
+#define V8KIT_STRING_ENUM(TYPE, META)                                                                                  \
+    template <>                                                                                                        \
+    struct v8kit::binding::StringEnum<TYPE> {                                                                          \
+        static v8kit::EnumMeta const& meta() { return META; }                                                          \
+    }
+
+#define V8KIT_INLINE_VALUE(TYPE)                                                                                       \
+    static_assert(std::is_trivially_copyable_v<TYPE>, "Inline value class must be trivially copyable");              \
+    static_assert(                                                                                                     \
+        sizeof(TYPE) <= v8kit::InstanceMemberMeta::kMaxInlineSize && alignof(TYPE) <= alignof(std::max_align_t),      \
+        "Inline value class is too large"                                                                              \
+    );                                                                                                                 \
+    template <>                                                                                                        \
+    struct v8kit::binding::InlineValue<TYPE> : std::true_type {}
+
+#define V8KIT_REFLECT(TYPE, ...)                                                                                       \
+    template <>                                                                                                        \
+    struct v8kit::binding::Reflect<TYPE> {                                                                             \
+        static constexpr auto fields = std::make_tuple(__VA_ARGS__);                                                   \
+    }
@@ -45,6 +45,14 @@ enum class ReturnValuePolicy : uint8_t {
      * 引用，父对象就不会被垃圾回收。这是通过 property 等创建的属性获取器（property getter）的默认策略。
      */
     kReferenceInternal = 5,
+
+    /**
+     * @brief 写时复制：返回值为左值引用或指针时，新实例先共享原对象（与 kReferenceInternal 一样保活父对象），
+     * 直到首次以可变方式访问（非 const 方法、setter）时才创建私有副本，此后与 kCopy 行为一致。
+     * 没有可保活的父实例时回退到 kCopy，右值回退到 kMove；多态下转型的对象同样回退到 kCopy。
+     * @note 副本产生之前，读取到的是原对象的当前状态（C++ 侧的修改对 JS 可见）。
+     */
+    kCopyOnWrite = 6,
 };
 
 
@@ -71,6 +79,15 @@ ReturnValuePolicy resolveAutomaticPolicy(ReturnValuePolicy policy) {
     return policy;
 }
 
+// members of an inline value class run on a stack copy, references into it must not outlive the call
+constexpr ReturnValuePolicy inlineValuePolicy(ReturnValuePolicy policy) {
+    if (policy == ReturnValuePolicy::kReference || policy == ReturnValuePolicy::kReferenceInternal
+        || policy == ReturnValuePolicy::kCopyOnWrite) {
+        return ReturnValuePolicy::kCopy;
+    }
+    return policy;
+}
+
 } // namespace detail
 
 } // namespace v8kit::binding
@@ -0,0 +1,37 @@
+#pragma once
+#include "v8kit/Macro.h"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace v8kit::binding {
+
+/**
+ * @brief Per-call scratch memory for temporary argument storage
+ * @note Monotonic: nothing is freed individually, everything is released when the arena goes out of scope
+ *       (the adapters keep one on the stack of each native callback). The first kInlineSize bytes come from an
+ *       inline buffer, so small string_view / span / std::pmr arguments never touch the heap.
+ * @note Memory handed out here is never destructed, only use it for trivially destructible data or std::pmr types.
+ */
+class ScratchArena {
+public:
+    static constexpr size_t kInlineSize = 512;
+
+    V8KIT_DISABLE_COPY_MOVE(ScratchArena);
+
+    ScratchArena() : resource_(buffer_.data(), buffer_.size()) {}
+
+    [[nodiscard]] std::pmr::memory_resource* resource() noexcept { return &resource_; }
+
+    template <typename T>
+    [[nodiscard]] T* allocate(size_t count) {
+        return static_cast<T*>(resource_.allocate(count * sizeof(T), alignof(T)));
+    }
+
+private:
+    alignas(std::max_align_t) std::array<std::byte, kInlineSize> buffer_;
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+} // namespace v8kit::binding
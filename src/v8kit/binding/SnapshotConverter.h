@@ -0,0 +1,198 @@
+#pragma once
+#include "Reflection.h"
+#include "v8kit/core/Concepts.h"
+#include "v8kit/core/Exception.h"
+#include "v8kit/core/Snapshot.h"
+
+#include <cmath>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace v8kit::binding {
+
+/**
+ * @brief Reads C++ values straight out of a Snapshot, the engine-free counterpart of TypeConverter::toCpp
+ * @note Specialize it with `static T fromSnapshot(Snapshot::Node const& node)` for custom types.
+ */
+template <typename T>
+struct SnapshotConverter;
+
+template <typename T>
+[[nodiscard]] T fromSnapshot(Snapshot::Node const& node) {
+    return SnapshotConverter<std::remove_cvref_t<T>>::fromSnapshot(node);
+}
+
+/**
+ * @brief JSON text -> C++ without creating any JS object (parsed by Snapshot::parseJson, no engine needed)
+ *
+ * @example
+ * auto config = fromJson<ServerConfig>(readFile("config.json")); // ServerConfig is V8KIT_REFLECT'ed
+ */
+template <typename T>
+[[nodiscard]] T fromJson(std::string_view json) {
+    auto snapshot = Snapshot::parseJson(json);
+    return fromSnapshot<T>(snapshot.root());
+}
+
+
+namespace detail {
+
+// JSON numbers outside the range of T (1e300 for an int) are rejected, casting them would be undefined
+template <typename T>
+T snapshotNumber(Snapshot::Node const& node) {
+    double value = node.asNumber();
+    if constexpr (std::is_integral_v<T>) {
+        double truncated = std::trunc(value);
+        double lowest    = std::is_signed_v<T> ? -std::ldexp(1.0, std::numeric_limits<T>::digits) : 0.0;
+        double bound     = std::ldexp(1.0, std::numeric_limits<T>::digits); // exclusive, exact in a double
+        if (!(truncated >= lowest && truncated < bound)) { // also NaN / Infinity
+            throw Exception{"Snapshot: number out of range of the target integer type", Exception::Type::RangeError};
+        }
+    } else {
+        if (std::isfinite(value) && std::abs(value) > static_cast<double>(std::numeric_limits<T>::max())) {
+            throw Exception{"Snapshot: number out of range of the target floating type", Exception::Type::RangeError};
+        }
+    }
+    return static_cast<T>(value);
+}
+
+} // namespace detail
+
+// bool
+template <>
+struct SnapshotConverter<bool> {
+    static bool fromSnapshot(Snapshot::Node const& node) { return node.asBoolean(); }
+};
+
+// int/uint/float/double/int64/uint64
+template <typename T>
+    requires concepts::NumberLike<T>
+struct SnapshotConverter<T> {
+    static T fromSnapshot(Snapshot::Node const& node) { return detail::snapshotNumber<T>(node); }
+};
+
+// enum (enum value)
+template <typename T>
+    requires(std::is_enum_v<T> && !StringMappedEnum<T>)
+struct SnapshotConverter<T> {
+    static T fromSnapshot(Snapshot::Node const& node) {
+        return static_cast<T>(detail::snapshotNumber<std::underlying_type_t<T>>(node));
+    }
+};
+
+// string-mapped enum (entry name, see StringEnum)
+template <typename T>
+    requires StringMappedEnum<T>
+struct SnapshotConverter<T> {
+    static T fromSnapshot(Snapshot::Node const& node) {
+        auto const& meta = StringEnum<T>::meta();
+        auto        name = node.asString();
+        for (auto const& entry : meta.entries_) {
+            if (entry.name_ == name) {
+                return static_cast<T>(entry.value_);
+            }
+        }
+        throw Exception{"Snapshot: expected one of the entry names of enum " + meta.name_, Exception::Type::TypeError};
+    }
+};
+
+// std::string
+template <>
+struct SnapshotConverter<std::string> {
+    static std::string fromSnapshot(Snapshot::Node const& node) { return std::string{node.asString()}; }
+};
+
+// std::optional (null)
+template <typename T>
+struct SnapshotConverter<std::optional<T>> {
+    static std::optional<T> fromSnapshot(Snapshot::Node const& node) {
+        if (node.isNull()) {
+            return std::nullopt;
+        }
+        return std::optional<T>{binding::fromSnapshot<T>(node)};
+    }
+};
+
+// std::vector (array)
+template <typename T>
+struct SnapshotConverter<std::vector<T>> {
+    static std::vector<T> fromSnapshot(Snapshot::Node const& node) {
+        if (!node.isArray()) {
+            throw Exception{"Snapshot: expected an array", Exception::Type::TypeError};
+        }
+        std::vector<T> result;
+        result.reserve(node.size());
+        for (size_t i = 0; i < node.size(); ++i) {
+            result.push_back(binding::fromSnapshot<T>(node[i]));
+        }
+        return result;
+    }
+};
+
+namespace detail {
+
+template <typename T>
+inline constexpr bool IsOptional_v = false;
+template <typename T>
+inline constexpr bool IsOptional_v<std::optional<T>> = true;
+
+template <typename M>
+struct MapLikeSnapshotConverter {
+    static_assert(std::is_same_v<typename M::key_type, std::string>, "Snapshot objects only have string keys");
+
+    static M fromSnapshot(Snapshot::Node const& node) {
+        if (!node.isObject()) {
+            throw Exception{"Snapshot: expected an object", Exception::Type::TypeError};
+        }
+        M result;
+        for (size_t i = 0; i < node.size(); ++i) {
+            result.emplace(std::string{node.keyAt(i)}, binding::fromSnapshot<typename M::mapped_type>(node[i]));
+        }
+        return result;
+    }
+};
+
+} // namespace detail
+
+// std::unordered_map / std::map (object)
+template <typename K, typename V, typename... Rest>
+struct SnapshotConverter<std::unordered_map<K, V, Rest...>>
+: detail::MapLikeSnapshotConverter<std::unordered_map<K, V, Rest...>> {};
+
+template <typename K, typename V, typename... Rest>
+struct SnapshotConverter<std::map<K, V, Rest...>> : detail::MapLikeSnapshotConverter<std::map<K, V, Rest...>> {};
+
+// reflected struct (object, see Reflection.h)
+template <typename T>
+    requires Reflected<T>
+struct SnapshotConverter<T> {
+    static T fromSnapshot(Snapshot::Node const& node) {
+        static_assert(std::is_default_constructible_v<T>, "Reflected type must be default constructible");
+        if (!node.isObject()) {
+            throw Exception{"Snapshot: expected an object", Exception::Type::TypeError};
+        }
+        T result{};
+        std::apply([&](auto const&... fields) { (readField(node, result, fields), ...); }, Reflect<T>::fields);
+        return result;
+    }
+
+private:
+    template <typename F>
+    static void readField(Snapshot::Node const& node, T& result, F const& field) {
+        using Member = typename F::Member;
+        if (auto value = node.find(field.name_)) {
+            result.*(field.member_) = binding::fromSnapshot<Member>(*value);
+        } else if constexpr (!detail::IsOptional_v<Member>) { // absent optionals stay nullopt
+            throw Exception{"Snapshot: missing field '" + std::string{field.name_} + "'", Exception::Type::TypeError};
+        }
+    }
+};
+
+} // namespace v8kit::binding
@@ -0,0 +1,200 @@
+#pragma once
+#include "v8kit/Macro.h"
+#include "v8kit/core/Engine.h"
+#include "v8kit/core/EngineScope.h"
+#include "v8kit/core/Exception.h"
+#include "v8kit/core/Reference.h"
+#include "v8kit/core/Value.h"
+
+#include <concepts>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace v8kit::binding {
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation_;
+    std::exception_ptr      exception_;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+            if (auto next = handle.promise().continuation_) {
+                return next; // symmetric transfer back to the awaiting coroutine
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter        final_suspend() noexcept { return {}; }
+    void                unhandled_exception() noexcept { exception_ = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value_;
+
+    Task<T> get_return_object() noexcept;
+
+    template <typename U = T>
+        requires std::convertible_to<U, T>
+    void return_value(U&& value) {
+        value_.emplace(std::forward<U>(value));
+    }
+
+    T result() {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+        return std::move(*value_);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void result() {
+        if (exception_) {
+            std::rethrow_exception(exception_);
+        }
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief A lazily started C++20 coroutine, returned from a bound function or method it reaches scripts as a Promise
+ * @note The coroutine starts when the Promise is created (or when another coroutine co_awaits it) and settles the
+ *       Promise when it returns or throws. It may suspend on `co_await Local<Promise>`, which resumes it from the
+ *       engine's task queue (Engine::runOnce / runLoop), so no thread waits for the script.
+ * @note Local handles do not survive a suspension: keep what is needed afterwards in Globals or C++ values.
+ * @note Bound coroutines take their arguments by value (std::string, not std::string const& / std::string_view):
+ *       the converted arguments of the call are gone once it returns, references and views are rejected at compile
+ *       time. A Local argument is only valid until the first suspension.
+ *       A bound method keeps its `this` object alive until the Promise settles.
+ *
+ * @example
+ * Task<int> Service::fetchScore(std::string name) {
+ *     auto result = co_await engine.globalThis().get("lookup"_key).asFunction()
+ *                       .call({}, {String::newString(name)}).asPromise();
+ *     co_return result.asNumber().getInt32() * 2;
+ * }
+ * // script: const score = await service.fetchScore("alice");
+ */
+template <typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    V8KIT_DISABLE_COPY(Task);
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~Task() {
+        if (handle_) handle_.destroy();
+    }
+
+    [[nodiscard]] bool done() const { return !handle_ || handle_.done(); }
+
+    /**
+     * Start the task (if needed) and resume the awaiting coroutine with its result once it completes
+     */
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> handle_;
+
+            bool await_ready() const noexcept { return handle_.done(); }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                handle_.promise().continuation_ = awaiting;
+                return handle_;
+            }
+
+            T await_resume() { return handle_.promise().result(); }
+        };
+        return Awaiter{handle_};
+    }
+
+private:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    friend promise_type;
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+template <typename T>
+Task<T> detail::TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+inline Task<void> detail::TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+
+/**
+ * @brief Awaiter of `co_await Local<Promise>`: the fulfilled value, or the rejection reason thrown as an Exception
+ * @note A pending promise suspends the coroutine, its reaction posts the resumption to the engine's task queue.
+ *       The coroutine must not be destroyed while it waits.
+ */
+class PromiseAwaiter {
+public:
+    explicit PromiseAwaiter(Local<Promise> const& promise) : promise_(promise) {}
+
+    bool await_ready() const { return promise_.get().state() != PromiseState::kPending; }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        auto* engine = &EngineScope::currentEngineChecked();
+        auto  resume = Function::newFunction([engine, handle](Arguments const&) -> Local<Value> {
+            engine->postTask([handle] { handle.resume(); });
+            return {};
+        });
+        (void)promise_.get().then(resume, resume);
+    }
+
+    Local<Value> await_resume() const {
+        auto promise = promise_.get();
+        if (promise.state() == PromiseState::kRejected) {
+            throw Exception{promise.result()};
+        }
+        return promise.result();
+    }
+
+private:
+    Global<Promise> promise_;
+};
+
+} // namespace v8kit::binding
+
+namespace v8kit {
+
+// found by ADL: `co_await someLocalPromise` in any coroutine type
+inline binding::PromiseAwaiter operator co_await(Local<Promise> const& promise) {
+    return binding::PromiseAwaiter{promise};
+}
+
+} // namespace v8kit
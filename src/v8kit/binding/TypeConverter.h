@@ -1,16 +1,38 @@
 #pragma once
+#include "ContainerView.h"
+#include "LazyRange.h"
 #include "NativeInstanceImpl.h"
+#include "Reflection.h"
 #include "ReturnValuePolicy.h"
+#include "Task.h"
 #include "traits/Polymorphic.h"
 #include "traits/TypeTraits.h"
+#include "v8kit/core/Engine.h"
+#include "v8kit/core/EngineScope.h"
 #include "v8kit/core/Exception.h"
 #include "v8kit/core/InstancePayload.h"
 #include "v8kit/core/Reference.h"
 #include "v8kit/core/Value.h"
+#include "v8kit/core/ViewHandler.h"
 
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <variant>
+#include <vector>
 
 namespace v8kit::binding {
 
@@ -21,6 +43,16 @@ struct GenericTypeConverter;
 
 } // namespace detail
 
+namespace adapter { // Adapter.h (included at the end of this file)
+
+template <typename R, typename... Args>
+std::function<R(Args...)> wrapScriptCallback(Local<Value> const& value);
+
+template <typename Fn>
+FunctionCallback wrapFunction(Fn&& fn, ReturnValuePolicy policy);
+
+} // namespace adapter
+
 /**
  * @brief 类型转换器
  * @tparam T C++ RawType (class Foo const& -> Foo -> TypeConverter<Foo>::toJs/toCpp)
@@ -110,6 +142,9 @@ struct GenericTypeConverter {
     template <typename U>
     static Local<Value> toJs(U&& value, ReturnValuePolicy policy, Local<Value> parent) {
         policy = handleAutomaticPolicy<U>(policy);
+        if (policy == ReturnValuePolicy::kCopyOnWrite) {
+            policy = resolveCopyOnWrite<U>(parent);
+        }
 
         using ElementType   = typename traits::detail::ElementTypeExtractor<U>::type;
         ElementType* rawPtr = nullptr;
@@ -137,7 +172,7 @@ struct GenericTypeConverter {
         auto&         engine = EngineScope::currentEngineChecked();
         Local<Object> jsObj  = engine.newInstance(*resolved.meta, std::move(instance));
 
-        if (policy == ReturnValuePolicy::kReferenceInternal) {
+        if (policy == ReturnValuePolicy::kReferenceInternal || policy == ReturnValuePolicy::kCopyOnWrite) {
             if (!parent.isObject()) {
                 throw Exception("kReferenceInternal requires a valid parent object");
             }
@@ -148,15 +183,97 @@ struct GenericTypeConverter {
         return jsObj;
     }
 
+    /**
+     * @brief Batch variant of toJs for a range of native objects (see Engine::newInstances)
+     * @note The class meta of a non-polymorphic T is resolved once for the whole range.
+     */
+    template <typename Range>
+    static Local<Value> toJsArray(Range&& range, ReturnValuePolicy policy, Local<Value> parent) {
+        // elements of an rvalue range are moved from
+        using Element = std::conditional_t<
+            std::is_lvalue_reference_v<Range>,
+            std::ranges::range_reference_t<Range>,
+            std::ranges::range_rvalue_reference_t<Range>>;
+        using ElementType = typename traits::detail::ElementTypeExtractor<Element>::type;
+        using BaseE       = std::remove_reference_t<Element>;
+
+        policy = handleAutomaticPolicy<Element>(policy);
+        if (policy == ReturnValuePolicy::kCopyOnWrite) {
+            policy = resolveCopyOnWrite<Element>(parent);
+        }
+        bool const keepParent =
+            policy == ReturnValuePolicy::kReferenceInternal || policy == ReturnValuePolicy::kCopyOnWrite;
+        if (keepParent && !parent.isObject()) {
+            throw Exception("kReferenceInternal requires a valid parent object");
+        }
+
+        std::vector<std::unique_ptr<NativeInstance>> instances;
+        instances.reserve(std::ranges::size(range));
+
+        std::optional<traits::detail::ResolvedCastSource> cached;
+        for (auto&& element : range) {
+            ElementType* rawPtr = nullptr;
+            if constexpr (std::is_pointer_v<BaseE>) {
+                rawPtr = element;
+            } else if constexpr (traits::is_unique_ptr_v<std::remove_cv_t<BaseE>>
+                                 || traits::is_shared_ptr_v<std::remove_cv_t<BaseE>>) {
+                rawPtr = element.get();
+            } else {
+                rawPtr = &element;
+            }
+            if (!rawPtr) {
+                instances.emplace_back(nullptr);
+                continue;
+            }
+
+            traits::detail::ResolvedCastSource resolved;
+            if constexpr (std::is_polymorphic_v<std::remove_cv_t<ElementType>>) {
+                resolved = traits::detail::resolveCastSource<ElementType>(rawPtr);
+            } else {
+                if (!cached) cached = traits::detail::resolveCastSource<ElementType>(rawPtr);
+                resolved     = *cached;
+                resolved.ptr = rawPtr;
+            }
+            instances.push_back(factory::createNativeInstance(static_cast<Element>(element), policy, resolved));
+        }
+
+        auto& engine = EngineScope::currentEngineChecked();
+        return engine.newInstances(std::move(instances), keepParent ? parent : Local<Value>{});
+    }
+
     // JS -> C++
-    static T* toCpp(Local<Value> const& value) {
+    static T* toCpp(Local<Value> const& value) { return unwrapInstance<T>(value); }
+
+    // JS -> C++ (const access, used for T const& / T const* parameters; copy-on-write instances stay shared)
+    static T const* toCppConst(Local<Value> const& value) { return unwrapInstance<T const>(value); }
+
+private:
+    // kCopyOnWrite shares the source only while a native parent instance can keep it alive
+    template <typename U>
+    static ReturnValuePolicy resolveCopyOnWrite(Local<Value> const& parent) {
+        using BaseU = std::remove_reference_t<U>;
+        if constexpr (traits::is_unique_ptr_v<BaseU> || traits::is_shared_ptr_v<BaseU>) {
+            return ReturnValuePolicy::kMove; // smart pointers keep their own ownership semantics
+        } else if constexpr (!std::is_pointer_v<BaseU> && !std::is_lvalue_reference_v<U>) {
+            return ReturnValuePolicy::kMove;
+        } else {
+            auto& engine = EngineScope::currentEngineChecked();
+            if (parent.isObject() && engine.getInstancePayload(parent.asObject())) {
+                return ReturnValuePolicy::kCopyOnWrite;
+            }
+            return ReturnValuePolicy::kCopy;
+        }
+    }
+
+    template <typename Target>
+    static Target* unwrapInstance(Local<Value> const& value) {
         auto& engine  = EngineScope::currentEngineChecked();
         auto  payload = engine.getInstancePayload(value.asObject());
         if (!payload) {
-            throw Exception("Argument is not a native instance");
+            throw Exception("Argument is not a native instance", Exception::Type::TypeError);
         }
-        auto ptr = payload->getHolder()->unwrap<T>();
-        if (!ptr) throw Exception("Type mismatch or cast failed");
+        auto ptr = payload->getHolder()->unwrap<Target>();
+        if (!ptr) throw Exception("Type mismatch or cast failed", Exception::Type::TypeError);
         return ptr;
     }
 };
@@ -217,12 +334,67 @@ struct TypeConverter<T> {
 
 // enum -> Number (enum value)
 template <typename T>
-    requires std::is_enum_v<T>
+    requires(std::is_enum_v<T> && !StringMappedEnum<T>)
 struct TypeConverter<T> {
     static Local<Number> toJs(T value) { return Number::newNumber(static_cast<int>(value)); }
     static T             toCpp(Local<Value> const& value) { return static_cast<T>(value.asNumber().getInt32()); }
 };
 
+// inline value class <-> wrapper holding a copy of the bytes (see InlineValue)
+template <typename T>
+    requires InlineValueType<T>
+struct TypeConverter<T> {
+    static Local<Value> toJs(T const& value) {
+        auto& engine = EngineScope::currentEngineChecked();
+        return engine.newInlineValue(meta(engine), std::addressof(value));
+    }
+    static Local<Value> toJs(T const* value) {
+        if (!value) return Null::newNull();
+        return toJs(*value);
+    }
+    static T toCpp(Local<Value> const& value) {
+        auto&                            engine = EngineScope::currentEngineChecked();
+        std::array<std::byte, sizeof(T)> bytes;
+        if (!engine.readInlineValue(value, meta(engine), bytes.data())) {
+            throw Exception{"Argument is not a " + meta(engine).name_, Exception::Type::TypeError};
+        }
+        return std::bit_cast<T>(bytes);
+    }
+
+private:
+    static ClassMeta const& meta(Engine& engine) {
+        auto meta = engine.getClassMeta(std::type_index{typeid(T)});
+        if (!meta) {
+            throw Exception("Class not registered: " + std::string{typeid(T).name()});
+        }
+        return *meta;
+    }
+};
+
+// string-mapped enum <-> String (entry name, see StringEnum)
+template <typename T>
+    requires StringMappedEnum<T>
+struct TypeConverter<T> {
+    static Local<String> toJs(T value) {
+        auto const& meta = StringEnum<T>::meta();
+        for (size_t i = 0; i < meta.entries_.size(); ++i) {
+            if (meta.entries_[i].value_ == static_cast<int64_t>(value)) {
+                return EngineScope::currentEngineChecked().enumEntryName(meta, i);
+            }
+        }
+        throw Exception{"Value is not an entry of enum " + meta.name_, Exception::Type::TypeError};
+    }
+    static T toCpp(Local<Value> const& value) {
+        auto const& meta = StringEnum<T>::meta();
+        if (value.isString()) {
+            if (auto index = EngineScope::currentEngineChecked().enumEntryIndex(meta, value.asString())) {
+                return static_cast<T>(meta.entries_[*index].value_);
+            }
+        }
+        throw Exception{"Expected one of the entry names of enum " + meta.name_, Exception::Type::TypeError};
+    }
+};
+
 // std::optional <-> null/undefined
 template <typename T>
 struct TypeConverter<std::optional<T>> {
@@ -240,49 +412,493 @@ struct TypeConverter<std::optional<T>> {
     }
 };
 
+namespace detail {
+
+// T is a bound native class (converted by GenericTypeConverter)
+template <typename T>
+inline constexpr bool IsNativeClass_v = std::conjunction_v<
+    std::is_class<T>,
+    std::is_base_of<GenericTypeConverter<std::remove_cv_t<T>>, TypeConverter<std::remove_cv_t<T>>>>;
+
+// T holds a Local handle (Local<T>, std::vector<Local<T>>, ...), so it must not outlive the handle scope it came from
+template <typename T>
+inline constexpr bool ContainsLocal_v = false;
+template <typename T>
+inline constexpr bool ContainsLocal_v<Local<T>> = true;
+template <template <typename...> typename C, typename... Ts>
+inline constexpr bool ContainsLocal_v<C<Ts...>> = (ContainsLocal_v<Ts> || ...);
+
+} // namespace detail
+
 // std::vector <-> Array
 template <typename T>
 struct TypeConverter<std::vector<T>> {
+    // plain numbers can be read in bulk via Local<Array>::readNumbers (int64/uint64 may arrive as BigInt)
+    static constexpr bool kNumericFastPath = concepts::NumberLike<T> && !std::same_as<T, bool>;
+
+    // vectors of native classes (T / T* / smart pointers) are wrapped in one batch, see Engine::newInstances
+    using ElementType                     = typename traits::detail::ElementTypeExtractor<T>::type;
+    static constexpr bool kNativeElements = detail::IsNativeClass_v<ElementType>;
+
+    static Local<Value> toJs(std::vector<T> const& value, ReturnValuePolicy policy, Local<Value> parent)
+        requires kNativeElements
+    {
+        return detail::GenericTypeConverter<std::remove_cv_t<ElementType>>::toJsArray(value, policy, parent);
+    }
+    static Local<Value> toJs(std::vector<T>&& value, ReturnValuePolicy policy, Local<Value> parent)
+        requires kNativeElements
+    {
+        return detail::GenericTypeConverter<std::remove_cv_t<ElementType>>::toJsArray(std::move(value), policy, parent);
+    }
+
     static Local<Value> toJs(std::vector<T> const& value) {
-        auto array = Array::newArray(value.size());
-        for (std::size_t i = 0; i < value.size(); ++i) {
-            array.set(i, binding::toJs(value[i]));
+        if constexpr (kNativeElements) {
+            return toJs(value, ReturnValuePolicy::kAutomatic, Local<Value>{});
+        } else if (value.size() > ChunkedHandleScope::kDefaultChunk) {
+            // large vectors: fill in place, so the element handles are released chunk by chunk
+            auto               array = Array::newArray(value.size());
+            ChunkedHandleScope chunk;
+            for (size_t i = 0; i < value.size(); ++i) {
+                array.set(i, binding::toJs(value[i]));
+                chunk.step();
+            }
+            return array;
+        } else {
+            // convert first, then create the array in one step instead of one Set() per element
+            std::vector<Local<Value>> elements;
+            elements.reserve(value.size());
+            for (auto&& element : value) {
+                elements.push_back(binding::toJs(element));
+            }
+            return Array::newArray(elements);
         }
-        return array;
     }
     static std::vector<T> toCpp(Local<Value> const& value) {
         auto array = value.asArray();
 
         std::vector<T> result;
+        if constexpr (kNumericFastPath) {
+            result.resize(array.length());
+            if (array.readNumbers(std::span<T>{result})) {
+                return result;
+            }
+            result.clear(); // mixed elements, fall back to per-element conversion
+        }
         result.reserve(array.length());
-        for (std::size_t i = 0; i < array.length(); ++i) {
-            result.push_back(binding::toCpp<T>(array[i]));
+        if constexpr (detail::ContainsLocal_v<T>) {
+            array.forEach([&result](size_t, Local<Value> const& element) {
+                result.push_back(binding::toCpp<T>(element));
+            });
+        } else {
+            ChunkedHandleScope chunk;
+            array.forEach([&](size_t, Local<Value> const& element) {
+                result.push_back(binding::toCpp<T>(element));
+                chunk.step();
+            });
+        }
+        return result;
+    }
+};
+
+namespace detail {
+
+/**
+ * @brief std::map / std::unordered_map converter
+ * @note string keys <-> plain Object (built in one step), other keys <-> JavaScript Map
+ * @note toCpp accepts a JavaScript Map for any key type
+ */
+template <typename M>
+struct MapLikeTypeConverter {
+    using K = typename M::key_type;
+    using V = typename M::mapped_type;
+    static_assert(HasTypeConverter_v<K>, "Cannot convert map to Map/Object; type K has no TypeConverter");
+    static_assert(HasTypeConverter_v<V>, "Cannot convert map to Map/Object; type V has no TypeConverter");
+
+    static constexpr bool kStringKey = concepts::StringLike<K>;
+
+    static Local<Value> toJs(M const& value) {
+        if constexpr (kStringKey) {
+            std::vector<Local<String>> keys;
+            std::vector<Local<Value>>  values;
+            if (value.size() > ChunkedHandleScope::kDefaultChunk) {
+                // large maps: set one chunk at a time, releasing the handles of each chunk
+                auto               object = Object::newObject();
+                ChunkedHandleScope chunk{1};
+                keys.reserve(ChunkedHandleScope::kDefaultChunk);
+                values.reserve(ChunkedHandleScope::kDefaultChunk);
+                for (auto const& [key, val] : value) {
+                    keys.push_back(String::newString(std::string_view{key}));
+                    values.push_back(binding::toJs(val));
+                    if (keys.size() == ChunkedHandleScope::kDefaultChunk) {
+                        object.setMany(keys, values);
+                        keys.clear();
+                        values.clear();
+                        chunk.step();
+                    }
+                }
+                object.setMany(keys, values);
+                return object;
+            }
+            keys.reserve(value.size());
+            values.reserve(value.size());
+            for (auto const& [key, val] : value) {
+                keys.push_back(String::newString(std::string_view{key}));
+                values.push_back(binding::toJs(val));
+            }
+            return Object::newObject(keys, values);
+        } else {
+            auto               map = Map::newMap();
+            ChunkedHandleScope chunk;
+            for (auto const& [key, val] : value) {
+                map.set(binding::toJs(key), binding::toJs(val));
+                chunk.step();
+            }
+            return map;
+        }
+    }
+
+    static M toCpp(Local<Value> const& value) {
+        M result;
+        if (value.isMap()) {
+            std::optional<ChunkedHandleScope> chunk;
+            if constexpr (!ContainsLocal_v<K> && !ContainsLocal_v<V>) {
+                chunk.emplace();
+            }
+            value.asMap().forEach([&](Local<Value> const& key, Local<Value> const& val) {
+                result.insert_or_assign(K(binding::toCpp<K>(key)), binding::toCpp<V>(val));
+                if (chunk) chunk->step();
+            });
+            return result;
+        }
+        if constexpr (kStringKey) {
+            if (value.isObject()) {
+                auto object = value.asObject();
+                if constexpr (ContainsLocal_v<V>) {
+                    // converted values keep the handles, which forEachOwnProperty releases batch by batch
+                    for (auto const& key : object.getOwnPropertyNames()) {
+                        result.insert_or_assign(K(key.getValue()), binding::toCpp<V>(object.get(key)));
+                    }
+                } else {
+                    object.forEachOwnProperty([&result](std::string_view key, Local<Value> const& val) {
+                        result.insert_or_assign(K(key), binding::toCpp<V>(val));
+                    });
+                }
+                return result;
+            }
+        }
+        [[unlikely]] throw Exception{"Cannot convert value to map, expected Map or Object", Exception::Type::TypeError};
+    }
+};
+
+/**
+ * @brief std::set / std::unordered_set <-> JavaScript Set (toCpp also accepts an Array)
+ */
+template <typename S>
+struct SetLikeTypeConverter {
+    using K = typename S::key_type;
+    static_assert(HasTypeConverter_v<K>, "Cannot convert set to Set; type K has no TypeConverter");
+
+    static Local<Value> toJs(S const& value) {
+        auto               set = Set::newSet();
+        ChunkedHandleScope chunk;
+        for (auto const& element : value) {
+            set.add(binding::toJs(element));
+            chunk.step();
+        }
+        return set;
+    }
+
+    static S toCpp(Local<Value> const& value) {
+        Local<Array> elements = value.isSet() ? value.asSet().toArray() : value.asArray();
+
+        S                                 result;
+        std::optional<ChunkedHandleScope> chunk;
+        if constexpr (!ContainsLocal_v<K>) {
+            chunk.emplace();
         }
+        elements.forEach([&](size_t, Local<Value> const& element) {
+            result.insert(K(binding::toCpp<K>(element)));
+            if (chunk) chunk->step();
+        });
         return result;
     }
 };
 
-template <typename K, typename V>
-    requires concepts::StringLike<K> // JavaScript only supports string keys
-struct TypeConverter<std::unordered_map<K, V>> {
-    static_assert(HasTypeConverter_v<V>, "Cannot convert std::unordered_map to Object; type V has no TypeConverter");
+} // namespace detail
+
+// std::unordered_map <-> Object / Map
+template <typename K, typename V, typename... Rest>
+struct TypeConverter<std::unordered_map<K, V, Rest...>>
+: detail::MapLikeTypeConverter<std::unordered_map<K, V, Rest...>> {};
+
+// std::map <-> Object / Map
+template <typename K, typename V, typename... Rest>
+struct TypeConverter<std::map<K, V, Rest...>> : detail::MapLikeTypeConverter<std::map<K, V, Rest...>> {};
+
+// std::unordered_set <-> Set
+template <typename K, typename... Rest>
+struct TypeConverter<std::unordered_set<K, Rest...>> : detail::SetLikeTypeConverter<std::unordered_set<K, Rest...>> {};
+
+// std::set <-> Set
+template <typename K, typename... Rest>
+struct TypeConverter<std::set<K, Rest...>> : detail::SetLikeTypeConverter<std::set<K, Rest...>> {};
+
+namespace detail {
+
+template <typename T>
+class VectorViewHandler final : public IndexedViewHandler {
+    VectorView<T> view_;
+
+public:
+    explicit VectorViewHandler(VectorView<T> view) : view_(view) {}
+
+    uint32_t length() const override { return static_cast<uint32_t>(view_.container().size()); }
+
+    Local<Value> get(uint32_t index) override { return binding::toJs(std::as_const(view_.container())[index]); }
+
+    void set(uint32_t index, Local<Value> const& value) override {
+        if constexpr (std::is_const_v<T>) {
+            throw Exception{"Cannot write to a read-only VectorView", Exception::Type::TypeError};
+        } else {
+            auto& container = view_.container();
+            if (index < container.size()) {
+                container[index] = binding::toCpp<T>(value);
+            } else if (index == container.size()) {
+                container.push_back(binding::toCpp<T>(value));
+            } else {
+                throw Exception{"VectorView index out of range", Exception::Type::RangeError};
+            }
+        }
+    }
+};
+
+template <typename K, typename V, typename M>
+class MapViewHandler final : public NamedViewHandler {
+    MapView<K, V, M> view_;
+
+    static K keyOf(Local<String> const& key) { return binding::toCpp<K>(key.asValue()); }
+
+public:
+    explicit MapViewHandler(MapView<K, V, M> view) : view_(view) {}
+
+    bool has(Local<String> const& key) const override { return view_.container().contains(keyOf(key)); }
+
+    std::optional<Local<Value>> get(Local<String> const& key) override {
+        auto const& container = std::as_const(view_.container());
+        auto        iter      = container.find(keyOf(key));
+        if (iter == container.end()) return std::nullopt;
+        return binding::toJs(iter->second);
+    }
+
+    void set(Local<String> const& key, Local<Value> const& value) override {
+        if constexpr (std::is_const_v<V>) {
+            throw Exception{"Cannot write to a read-only MapView", Exception::Type::TypeError};
+        } else {
+            view_.container().insert_or_assign(keyOf(key), binding::toCpp<V>(value));
+        }
+    }
+
+    bool remove(Local<String> const& key) override {
+        if constexpr (std::is_const_v<V>) {
+            throw Exception{"Cannot delete from a read-only MapView", Exception::Type::TypeError};
+        } else {
+            return view_.container().erase(keyOf(key)) != 0;
+        }
+    }
+
+    Local<Array> keys() const override {
+        std::vector<Local<Value>> keys;
+        keys.reserve(view_.container().size());
+        for (auto const& [key, _] : view_.container()) {
+            keys.push_back(String::newString(std::string_view{key}));
+        }
+        return Array::newArray(keys);
+    }
+};
+
+template <typename R>
+class RangeIteratorHandler final : public IteratorHandler {
+    using Iterator = std::ranges::iterator_t<R>;
+
+    std::shared_ptr<R>      range_;
+    std::optional<Iterator> current_; // begin() is deferred to the first next(), input ranges may only begin once
+    size_t                  chunk_;
+    bool                    closed_{false};
+
+    bool exhausted() {
+        if (closed_) return true;
+        if (!current_) current_.emplace(std::ranges::begin(*range_));
+        return *current_ == std::ranges::end(*range_);
+    }
+
+public:
+    explicit RangeIteratorHandler(LazyRange<R> const& range) : range_(range.range()), chunk_(range.chunk()) {}
 
-    static Local<Value> toJs(std::unordered_map<K, V> const& value) {
-        auto object = Object::newObject();
-        for (auto const& [key, val] : value) {
-            object.set(String::newString(key), binding::toJs(val));
+    std::optional<Local<Value>> next() override {
+        if (exhausted()) return std::nullopt;
+        if (chunk_ == 0) {
+            auto value = binding::toJs(**current_);
+            ++*current_;
+            return value;
         }
-        return object;
+        std::vector<Local<Value>> batch;
+        batch.reserve(chunk_);
+        do {
+            batch.push_back(binding::toJs(**current_));
+            ++*current_;
+        } while (batch.size() < chunk_ && !exhausted());
+        return Array::newArray(batch);
+    }
+
+    void close() override {
+        closed_ = true;
+        current_.reset();
+        range_.reset();
+    }
+};
+
+} // namespace detail
+
+// VectorView -> live array-like object (owner: the `this` of the bound method returning it)
+template <typename T>
+struct TypeConverter<VectorView<T>> {
+    static Local<Value> toJs(VectorView<T> const& view, ReturnValuePolicy, Local<Value> parent) {
+        auto& engine = EngineScope::currentEngineChecked();
+        return engine.newIndexedView(std::make_unique<detail::VectorViewHandler<T>>(view), parent);
+    }
+    static Local<Value> toJs(VectorView<T> const& view) {
+        return toJs(view, ReturnValuePolicy::kAutomatic, Local<Value>{});
+    }
+};
+
+// MapView -> live object
+template <typename K, typename V, typename M>
+struct TypeConverter<MapView<K, V, M>> {
+    static Local<Value> toJs(MapView<K, V, M> const& view, ReturnValuePolicy, Local<Value> parent) {
+        auto& engine = EngineScope::currentEngineChecked();
+        return engine.newNamedView(std::make_unique<detail::MapViewHandler<K, V, M>>(view), parent);
+    }
+    static Local<Value> toJs(MapView<K, V, M> const& view) {
+        return toJs(view, ReturnValuePolicy::kAutomatic, Local<Value>{});
+    }
+};
+
+// LazyRange -> iterable, elements converted on demand (see Engine::newIterator)
+template <typename R>
+struct TypeConverter<LazyRange<R>> {
+    static Local<Value> toJs(LazyRange<R> const& range, ReturnValuePolicy, Local<Value> parent) {
+        auto& engine = EngineScope::currentEngineChecked();
+        return engine.newIterator(std::make_unique<detail::RangeIteratorHandler<R>>(range), parent);
     }
+    static Local<Value> toJs(LazyRange<R> const& range) {
+        return toJs(range, ReturnValuePolicy::kAutomatic, Local<Value>{});
+    }
+};
+
+namespace detail {
+
+// eager, self-destroying coroutine that drives a Task to completion
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask       get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void               return_void() noexcept {}
+        void               unhandled_exception() noexcept { std::terminate(); }
+    };
+};
 
-    static std::unordered_map<K, V> toCpp(Local<Value> const& value) {
-        auto object = value.asObject();
-        auto keys   = object.getOwnPropertyNames();
+template <typename T>
+DetachedTask settlePromise(Task<T> task, Global<PromiseResolver> resolver, Global<Value> owner, Engine* engine) {
+    std::optional<std::conditional_t<std::is_void_v<T>, std::monostate, T>> value;
+    std::exception_ptr                                                      error;
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await std::move(task);
+            value.emplace();
+        } else {
+            value.emplace(co_await std::move(task));
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
 
-        std::unordered_map<K, V> result;
-        for (auto const& key : keys) {
-            result[key.getValue()] = binding::toCpp<V>(object.get(key));
+    // resumed from the engine's task queue, the calling binding or any thread the task last awaited on
+    ReentrantEngineScope scope{engine};
+    try {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if constexpr (std::is_void_v<T>) {
+            resolver.get().resolve(Local<Value>{});
+        } else {
+            resolver.get().resolve(binding::toJs(std::move(*value)));
         }
+    } catch (Exception const& e) {
+        resolver.get().reject(e.exception());
+    } catch (std::exception const& e) {
+        resolver.get().reject(Exception{e.what()}.exception());
+    }
+    resolver.reset(); // while the engine is entered
+    owner.reset();
+}
+
+} // namespace detail
+
+// Task<T> -> Promise, settled when the coroutine completes (see Task.h)
+template <typename T>
+struct TypeConverter<Task<T>> {
+    // converters receive the returned task as an lvalue, it is moved into the driver
+    static Local<Value> toJs(Task<T>& task, ReturnValuePolicy, Local<Value> parent) {
+        auto& engine   = EngineScope::currentEngineChecked();
+        auto  resolver = PromiseResolver::newResolver();
+        auto  promise  = resolver.getPromise();
+        detail::settlePromise(std::move(task), Global<PromiseResolver>{resolver}, Global<Value>{parent}, &engine);
+        return promise;
+    }
+    static Local<Value> toJs(Task<T>& task) { return toJs(task, ReturnValuePolicy::kAutomatic, Local<Value>{}); }
+    static Local<Value> toJs(Task<T>&& task) { return toJs(task); }
+};
+
+// reflected struct <-> Object (fixed shape, see Reflection.h)
+template <typename T>
+    requires Reflected<T>
+struct TypeConverter<T> {
+    static Local<Value> toJs(T const& value) {
+        auto& engine = EngineScope::currentEngineChecked();
+        return std::apply(
+            [&](auto const&... fields) {
+                std::array<Local<Value>, sizeof...(fields)> values{binding::toJs(value.*(fields.member_))...};
+                return engine.newObject(detail::shapeOf<T>(), values);
+            },
+            Reflect<T>::fields
+        );
+    }
+
+    static T toCpp(Local<Value> const& value) {
+        static_assert(std::is_default_constructible_v<T>, "Reflected type must be default constructible");
+        auto&       engine = EngineScope::currentEngineChecked();
+        auto const& shape  = detail::shapeOf<T>();
+        auto        object = value.asObject();
+
+        // read all fields in one batch, then convert
+        constexpr size_t N    = std::tuple_size_v<std::remove_cvref_t<decltype(Reflect<T>::fields)>>;
+        auto             keys = [&]<size_t... I>(std::index_sequence<I...>) {
+            return std::array<Local<String>, N>{engine.shapeKey(shape, I)...};
+        }(std::make_index_sequence<N>{});
+        std::array<Local<Value>, N> values;
+        object.getMany(keys, values);
+
+        T      result{};
+        size_t index = 0;
+        std::apply(
+            [&](auto const&... fields) {
+                ((result.*(fields.member_) =
+                      binding::toCpp<typename std::remove_cvref_t<decltype(fields)>::Member>(values[index++])),
+                 ...);
+            },
+            Reflect<T>::fields
+        );
         return result;
     }
 };
@@ -357,21 +973,73 @@ struct TypeConverter<std::pair<Ty1, Ty2>> {
     }
 };
 
-// TODO: impl
-// std::function -> Function
-// template <typename R, typename... Args>
-// struct TypeConverter<std::function<R(Args...)>> {
-//     static_assert(
-//         (HasTypeConverter_v<Args> && ...),
-//         "Cannot convert std::function to Function; all parameter types must have a TypeConverter"
-//     );
-//     static Local<Value>              toJs(std::function<R(Args...)> const& value) {}
-//     static std::function<R(Args...)> toCpp(Local<Value> const& value) {}
-// };
+// std::function <-> Function
+template <typename R, typename... Args>
+struct TypeConverter<std::function<R(Args...)>> {
+    static_assert(
+        (HasTypeConverter_v<Args> && ...),
+        "Cannot convert std::function to Function; all parameter types must have a TypeConverter"
+    );
+    static Local<Value> toJs(std::function<R(Args...)> const& value) {
+        if (!value) {
+            return Null::newNull();
+        }
+        return Function::newFunction(adapter::wrapFunction(value, ReturnValuePolicy::kAutomatic));
+    }
+    static std::function<R(Args...)> toCpp(Local<Value> const& value) {
+        if (value.isNullOrUndefined()) {
+            return nullptr;
+        }
+        return adapter::wrapScriptCallback<R, Args...>(value);
+    }
+};
+
+// std::shared_ptr <-> native instance (ownership shared with the script wrapper)
+template <typename T>
+struct TypeConverter<std::shared_ptr<T>> {
+    static Local<Value> toJs(std::shared_ptr<T> value, ReturnValuePolicy policy, Local<Value> parent) {
+        return detail::GenericTypeConverter<std::remove_cv_t<T>>::toJs(std::move(value), policy, parent);
+    }
+    static Local<Value> toJs(std::shared_ptr<T> value) {
+        return toJs(std::move(value), ReturnValuePolicy::kAutomatic, Local<Value>{});
+    }
+
+    /**
+     * @note aliasing shared_ptr on the holder's control block (no allocation if the wrapper already holds a
+     *       shared_ptr, an owned unique holder is converted once); throws for instances the script does not own
+     */
+    static std::shared_ptr<T> toCpp(Local<Value> const& value) {
+        if (value.isNullOrUndefined()) {
+            return nullptr;
+        }
+        auto& engine  = EngineScope::currentEngineChecked();
+        auto  payload = engine.getInstancePayload(value.asObject());
+        if (!payload) {
+            throw Exception("Argument is not a native instance", Exception::Type::TypeError);
+        }
+        auto owner = payload->shareOwnership();
+        if (!owner) {
+            throw Exception{
+                "Cannot share ownership of a native instance that is not owned by the script",
+                Exception::Type::TypeError
+            };
+        }
+        auto ptr = payload->unwrap<T>();
+        if (!ptr) throw Exception("Type mismatch or cast failed", Exception::Type::TypeError);
+        return std::shared_ptr<T>{std::move(owner), ptr};
+    }
+};
 
-// TODO: support smart pointer
-// template <typename T>
-// struct TypeConverter<std::shared_ptr<T>> {};
+// std::weak_ptr <-> native instance (expired -> null)
+template <typename T>
+struct TypeConverter<std::weak_ptr<T>> {
+    static Local<Value> toJs(std::weak_ptr<T> const& value) {
+        return TypeConverter<std::shared_ptr<T>>::toJs(value.lock());
+    }
+    static std::weak_ptr<T> toCpp(Local<Value> const& value) {
+        return TypeConverter<std::shared_ptr<T>>::toCpp(value);
+    }
+};
 
 
 // free functions
@@ -399,7 +1067,19 @@ decltype(auto) toCpp(Local<Value> const& value) {
     using Conv    = RawTypeConverter<T>;
     using ConvRet = decltype(Conv::toCpp(std::declval<Local<Value>>()));
 
-    if constexpr (std::is_lvalue_reference_v<T>) {
+    constexpr bool ConstAccess = requires { Conv::toCppConst(value); };
+
+    if constexpr (std::is_lvalue_reference_v<T> && std::is_const_v<std::remove_reference_t<T>> && ConstAccess) {
+        // const 左值引用 T const& (不触发写时复制)
+        auto p = Conv::toCppConst(value);
+        if (p == nullptr) [[unlikely]] {
+            throw std::runtime_error("TypeConverter::toCpp returned a null pointer.");
+        }
+        return static_cast<T>(*p);
+    } else if constexpr (std::is_pointer_v<T> && std::is_const_v<std::remove_pointer_t<T>> && ConstAccess) {
+        // const 指针 T const*
+        return static_cast<T>(Conv::toCppConst(value));
+    } else if constexpr (std::is_lvalue_reference_v<T>) {
         // 左值引用 T&
         if constexpr (std::is_pointer_v<std::remove_reference_t<ConvRet>>) {
             auto p = Conv::toCpp(value); // 返回 T*
@@ -448,3 +1128,5 @@ decltype(auto) toCpp(Local<Value> const& value) {
 
 
 } // namespace v8kit::binding
+
+#include "Adapter.h" // NOLINT
@@ -1,14 +1,20 @@
 #include "Engine.h"
 
+#include "EngineScope.h"
 #include "Exception.h"
 #include "InstancePayload.h"
 #include "MetaInfo.h"
 #include "Reference.h"
 #include "Value.h"
 #include "ValueHelper.h"
+#include "ViewHandler.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstring>
 #include <fstream>
+#include <memory>
 
 
 V8KIT_WARNING_GUARD_BEGIN
@@ -18,9 +24,11 @@ V8KIT_WARNING_GUARD_BEGIN
 #include "v8-object.h"
 #include "v8-primitive.h"
 #include "v8-template.h"
+#include <v8-container.h>
 #include <v8-context.h>
 #include <v8-exception.h>
 #include <v8-isolate.h>
+#include <v8-json.h>
 #include <v8-locker.h>
 #include <v8-message.h>
 #include <v8-persistent-handle.h>
@@ -58,6 +66,16 @@ Engine::~Engine() {
 
     if (userData_) userData_.reset();
 
+    // async jobs may borrow managed resources and a shared pool outlives the engine: stop and wait for them first
+    if (taskQueue_) {
+        std::unique_lock lock{taskQueue_->mutex_};
+        taskQueue_->closed_ = true; // late async completions are dropped
+        for (auto& [_, call] : asyncCalls_) {
+            call.token_.cancel();
+        }
+        taskQueue_->ready_.wait(lock, [this] { return taskQueue_->running_ == 0; });
+    }
+
     {
         EngineScope scope(this);
 
@@ -70,13 +88,29 @@ Engine::~Engine() {
             ctor.Reset();
         }
 
+        if (taskQueue_) {
+            std::lock_guard lock{taskQueue_->mutex_};
+            taskQueue_->tasks_.clear(); // tasks may hold handles
+        }
+        asyncCalls_.clear();
+        timers_.clear();
+        dueTimers_.clear();
         constructorSymbol_.Reset();
+        objectPrototype_.Reset();
+        shapeCaches_.clear();
+        keyLiterals_.clear();
+        enumCaches_.clear();
+        indexedViewTemplate_.Reset();
+        namedViewTemplate_.Reset();
+        iteratorTemplate_.Reset();
         classConstructors_.clear();
         registeredClasses_.clear();
         managedResources_.clear();
         context_.Reset();
     }
 
+    workerPool_.reset(); // joins the default pool, no job of this engine is left in it
+
     if (!isExternalIsolate_) isolate_->Dispose();
 }
 
@@ -84,6 +118,367 @@ Engine::~Engine() {
 v8::Isolate*           Engine::isolate() const { return isolate_; }
 v8::Local<v8::Context> Engine::context() const { return context_.Get(isolate_); }
 
+v8::Local<v8::Value> Engine::objectPrototype() {
+    if (objectPrototype_.IsEmpty()) {
+        objectPrototype_.Reset(isolate_, v8::Object::New(isolate_)->GetPrototype());
+    }
+    return objectPrototype_.Get(isolate_);
+}
+
+Engine::ShapeCache& Engine::getShapeCache(ShapeMeta const& shape) {
+    if (auto iter = shapeCaches_.find(&shape); iter != shapeCaches_.end()) {
+        return iter->second;
+    }
+    std::vector<std::string_view> names{shape.fields_.begin(), shape.fields_.end()};
+
+    ShapeCache cache;
+    cache.template_.Reset(
+        isolate_,
+        v8::DictionaryTemplate::New(isolate_, v8::MemorySpan<const std::string_view>{names.data(), names.size()})
+    );
+    cache.keys_.reserve(names.size());
+    for (auto name : names) {
+        auto key = v8::String::NewFromUtf8(
+            isolate_,
+            name.data(),
+            v8::NewStringType::kInternalized,
+            static_cast<int>(name.size())
+        );
+        cache.keys_.emplace_back(isolate_, key.ToLocalChecked());
+    }
+    return shapeCaches_.emplace(&shape, std::move(cache)).first->second;
+}
+
+Local<String> Engine::keyLiteral(size_t id, std::string_view text) {
+    if (id >= keyLiterals_.size()) {
+        keyLiterals_.resize(id + 1);
+    }
+    auto& slot = keyLiterals_[id];
+    if (slot.IsEmpty()) {
+        auto str = v8::String::NewFromUtf8(
+            isolate_,
+            text.data(),
+            v8::NewStringType::kInternalized,
+            static_cast<int>(text.size())
+        );
+        slot.Reset(isolate_, str.ToLocalChecked());
+    }
+    return ValueHelper::wrap<String>(slot.Get(isolate_));
+}
+
+Local<Object> Engine::newObject(ShapeMeta const& shape, std::span<const Local<Value>> values) {
+    if (values.size() != shape.fields_.size()) {
+        throw Exception{"Engine::newObject: value count does not match the shape", Exception::Type::RangeError};
+    }
+    auto& cache = getShapeCache(shape);
+
+    static_assert(sizeof(Local<Value>) == sizeof(v8::MaybeLocal<v8::Value>));
+    auto raw = reinterpret_cast<v8::MaybeLocal<v8::Value>*>(const_cast<Local<Value>*>(values.data()));
+
+    v8::TryCatch vtry{isolate_};
+    auto         object = cache.template_.Get(isolate_)->NewInstance(
+        context_.Get(isolate_),
+        v8::MemorySpan<v8::MaybeLocal<v8::Value>>{raw, values.size()}
+    );
+    Exception::rethrow(vtry);
+    return ValueHelper::wrap<Object>(object);
+}
+
+Local<String> Engine::shapeKey(ShapeMeta const& shape, size_t index) {
+    auto& cache = getShapeCache(shape);
+    if (index >= cache.keys_.size()) {
+        throw Exception{"Engine::shapeKey: field index out of range", Exception::Type::RangeError};
+    }
+    return ValueHelper::wrap<String>(cache.keys_[index].Get(isolate_));
+}
+
+void* Engine::viewHandler(v8::Local<v8::Object> const& view) {
+    return view->GetAlignedPointerFromInternalField(kViewHandlerField);
+}
+
+v8::Local<v8::ObjectTemplate> Engine::indexedViewTemplate() {
+    if (!indexedViewTemplate_.IsEmpty()) {
+        return indexedViewTemplate_.Get(isolate_);
+    }
+    auto tmpl = v8::ObjectTemplate::New(isolate_);
+    tmpl->SetInternalFieldCount(kViewHandlerField + 1);
+
+    v8::IndexedPropertyGetterCallbackV2 getter = [](uint32_t index, v8::PropertyCallbackInfo<v8::Value> const& info) {
+        auto handler = static_cast<IndexedViewHandler*>(viewHandler(info.Holder()));
+        try {
+            if (index >= handler->length()) return v8::Intercepted::kNo;
+            info.GetReturnValue().Set(ValueHelper::unwrap(handler->get(index)));
+        } catch (Exception const& e) {
+            e.rethrowToRuntime();
+        }
+        return v8::Intercepted::kYes;
+    };
+    v8::IndexedPropertySetterCallbackV2 setter =
+        [](uint32_t index, v8::Local<v8::Value> value, v8::PropertyCallbackInfo<void> const& info) {
+            auto handler = static_cast<IndexedViewHandler*>(viewHandler(info.Holder()));
+            try {
+                handler->set(index, ValueHelper::wrap<Value>(value));
+            } catch (Exception const& e) {
+                e.rethrowToRuntime();
+            }
+            return v8::Intercepted::kYes;
+        };
+    v8::IndexedPropertyQueryCallbackV2 query = [](uint32_t index, v8::PropertyCallbackInfo<v8::Integer> const& info) {
+        auto handler = static_cast<IndexedViewHandler*>(viewHandler(info.Holder()));
+        if (index >= handler->length()) return v8::Intercepted::kNo;
+        info.GetReturnValue().Set(static_cast<int32_t>(v8::PropertyAttribute::DontDelete));
+        return v8::Intercepted::kYes;
+    };
+    v8::IndexedPropertyDeleterCallbackV2 deleter =
+        [](uint32_t index, v8::PropertyCallbackInfo<v8::Boolean> const& info) {
+            auto handler = static_cast<IndexedViewHandler*>(viewHandler(info.Holder()));
+            if (index >= handler->length()) return v8::Intercepted::kNo;
+            info.GetReturnValue().Set(false); // elements of a live view cannot be deleted
+            return v8::Intercepted::kYes;
+        };
+    v8::IndexedPropertyEnumeratorCallback enumerator = [](v8::PropertyCallbackInfo<v8::Array> const& info) {
+        auto handler = static_cast<IndexedViewHandler*>(viewHandler(info.Holder()));
+        auto isolate = info.GetIsolate();
+        auto length  = handler->length();
+
+        std::vector<v8::Local<v8::Value>> indices;
+        indices.reserve(length);
+        for (uint32_t i = 0; i < length; ++i) {
+            indices.push_back(v8::Integer::NewFromUnsigned(isolate, i));
+        }
+        info.GetReturnValue().Set(v8::Array::New(isolate, indices.data(), indices.size()));
+    };
+    tmpl->SetHandler(v8::IndexedPropertyHandlerConfiguration{getter, setter, query, deleter, enumerator});
+
+    tmpl->SetNativeDataProperty(
+        ValueHelper::unwrap(String::newString("length")).As<v8::Name>(),
+        [](v8::Local<v8::Name>, v8::PropertyCallbackInfo<v8::Value> const& info) {
+            auto handler = static_cast<IndexedViewHandler*>(viewHandler(info.Holder()));
+            info.GetReturnValue().Set(handler->length());
+        },
+        nullptr,
+        {},
+        PropertyAttribute::ReadOnly | PropertyAttribute::DontEnum | PropertyAttribute::DontDelete
+    );
+    // Array.prototype.values only needs `length` and indexed access
+    tmpl->SetIntrinsicDataProperty(
+        v8::Symbol::GetIterator(isolate_),
+        v8::Intrinsic::kArrayProto_values,
+        PropertyAttribute::DontEnum
+    );
+
+    indexedViewTemplate_.Reset(isolate_, tmpl);
+    return tmpl;
+}
+
+v8::Local<v8::ObjectTemplate> Engine::namedViewTemplate() {
+    if (!namedViewTemplate_.IsEmpty()) {
+        return namedViewTemplate_.Get(isolate_);
+    }
+    auto tmpl = v8::ObjectTemplate::New(isolate_);
+    tmpl->SetInternalFieldCount(kViewHandlerField + 1);
+
+    v8::NamedPropertyGetterCallback getter =
+        [](v8::Local<v8::Name> name, v8::PropertyCallbackInfo<v8::Value> const& info) {
+            auto handler = static_cast<NamedViewHandler*>(viewHandler(info.Holder()));
+            auto key     = ValueHelper::wrap<String>(name.As<v8::String>());
+            try {
+                auto value = handler->get(key);
+                if (!value) return v8::Intercepted::kNo;
+                info.GetReturnValue().Set(ValueHelper::unwrap(*value));
+            } catch (Exception const& e) {
+                e.rethrowToRuntime();
+            }
+            return v8::Intercepted::kYes;
+        };
+    v8::NamedPropertySetterCallback setter =
+        [](v8::Local<v8::Name> name, v8::Local<v8::Value> value, v8::PropertyCallbackInfo<void> const& info) {
+            auto handler = static_cast<NamedViewHandler*>(viewHandler(info.Holder()));
+            try {
+                handler->set(ValueHelper::wrap<String>(name.As<v8::String>()), ValueHelper::wrap<Value>(value));
+            } catch (Exception const& e) {
+                e.rethrowToRuntime();
+            }
+            return v8::Intercepted::kYes;
+        };
+    v8::NamedPropertyQueryCallback query =
+        [](v8::Local<v8::Name> name, v8::PropertyCallbackInfo<v8::Integer> const& info) {
+            auto handler = static_cast<NamedViewHandler*>(viewHandler(info.Holder()));
+            try {
+                if (!handler->has(ValueHelper::wrap<String>(name.As<v8::String>()))) return v8::Intercepted::kNo;
+                info.GetReturnValue().Set(static_cast<int32_t>(v8::PropertyAttribute::None));
+            } catch (Exception const& e) {
+                e.rethrowToRuntime();
+            }
+            return v8::Intercepted::kYes;
+        };
+    v8::NamedPropertyDeleterCallback deleter =
+        [](v8::Local<v8::Name> name, v8::PropertyCallbackInfo<v8::Boolean> const& info) {
+            auto handler = static_cast<NamedViewHandler*>(viewHandler(info.Holder()));
+            try {
+                if (!handler->remove(ValueHelper::wrap<String>(name.As<v8::String>()))) return v8::Intercepted::kNo;
+                info.GetReturnValue().Set(true);
+            } catch (Exception const& e) {
+                e.rethrowToRuntime();
+            }
+            return v8::Intercepted::kYes;
+        };
+    v8::NamedPropertyEnumeratorCallback enumerator = [](v8::PropertyCallbackInfo<v8::Array> const& info) {
+        auto handler = static_cast<NamedViewHandler*>(viewHandler(info.Holder()));
+        try {
+            info.GetReturnValue().Set(ValueHelper::unwrap(handler->keys()));
+        } catch (Exception const& e) {
+            e.rethrowToRuntime();
+        }
+    };
+    tmpl->SetHandler(v8::NamedPropertyHandlerConfiguration{
+        getter,
+        setter,
+        query,
+        deleter,
+        enumerator,
+        {},
+        v8::PropertyHandlerFlags::kOnlyInterceptStrings
+    });
+
+    namedViewTemplate_.Reset(isolate_, tmpl);
+    return tmpl;
+}
+
+namespace {
+ShapeMeta const IteratorResultShape{{"value", "done"}};
+} // namespace
+
+v8::Local<v8::FunctionTemplate> Engine::iteratorTemplate() {
+    if (!iteratorTemplate_.IsEmpty()) {
+        return iteratorTemplate_.Get(isolate_);
+    }
+    auto tmpl = v8::FunctionTemplate::New(isolate_);
+    tmpl->InstanceTemplate()->SetInternalFieldCount(kViewHandlerField + 1);
+    setToStringTag(tmpl, "Native Iterator", true);
+
+    auto prototype = tmpl->PrototypeTemplate();
+    auto signature = v8::Signature::New(isolate_, tmpl);
+
+    // next() -> { value, done }
+    prototype->Set(
+        ValueHelper::unwrap(String::newString("next")).As<v8::Name>(),
+        v8::FunctionTemplate::New(
+            isolate_,
+            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                auto handler = static_cast<IteratorHandler*>(viewHandler(info.Holder()));
+                try {
+                    auto next = handler->next();
+
+                    std::array<Local<Value>, 2> result{
+                        next ? *next : Local<Value>{},
+                        Boolean::newBoolean(!next.has_value())
+                    };
+                    auto& engine = EngineScope::currentEngineChecked();
+                    info.GetReturnValue().Set(ValueHelper::unwrap(engine.newObject(IteratorResultShape, result)));
+                } catch (Exception const& e) {
+                    e.rethrowToRuntime();
+                }
+            },
+            {},
+            signature
+        ),
+        PropertyAttribute::DontEnum
+    );
+    // return() is called by for-of on break / throw
+    prototype->Set(
+        ValueHelper::unwrap(String::newString("return")).As<v8::Name>(),
+        v8::FunctionTemplate::New(
+            isolate_,
+            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                auto handler = static_cast<IteratorHandler*>(viewHandler(info.Holder()));
+                try {
+                    handler->close();
+
+                    std::array<Local<Value>, 2> result{
+                        ValueHelper::wrap<Value>(info[0]),
+                        Boolean::newBoolean(true)
+                    };
+                    auto& engine = EngineScope::currentEngineChecked();
+                    info.GetReturnValue().Set(ValueHelper::unwrap(engine.newObject(IteratorResultShape, result)));
+                } catch (Exception const& e) {
+                    e.rethrowToRuntime();
+                }
+            },
+            {},
+            signature
+        ),
+        PropertyAttribute::DontEnum
+    );
+    prototype->Set(
+        v8::Symbol::GetIterator(isolate_),
+        v8::FunctionTemplate::New(
+            isolate_,
+            [](v8::FunctionCallbackInfo<v8::Value> const& info) { info.GetReturnValue().Set(info.This()); }
+        ),
+        PropertyAttribute::DontEnum
+    );
+
+    iteratorTemplate_.Reset(isolate_, tmpl);
+    return tmpl;
+}
+
+Local<Object> Engine::newView(v8::Local<v8::ObjectTemplate> tmpl, void* handler, Local<Value> const& owner) {
+    if (!handler) {
+        [[unlikely]] throw std::logic_error{"Engine::newView: handler cannot be null"};
+    }
+    v8::TryCatch vtry{isolate_};
+    auto         maybe = tmpl->NewInstance(context_.Get(isolate_));
+    Exception::rethrow(vtry);
+
+    auto object = maybe.ToLocalChecked();
+    object->SetAlignedPointerInInternalField(static_cast<int>(InternalFieldSolt::InstancePayload), nullptr);
+    object->SetAlignedPointerInInternalField(kViewHandlerField, handler);
+    if (owner.isObject()) {
+        object->SetInternalField(static_cast<int>(InternalFieldSolt::ParentClassThisRef), ValueHelper::unwrap(owner));
+    }
+    return ValueHelper::wrap<Object>(object);
+}
+
+Local<Object> Engine::newIndexedView(std::unique_ptr<IndexedViewHandler> handler) {
+    return newIndexedView(std::move(handler), Local<Value>{});
+}
+
+Local<Object> Engine::newIndexedView(std::unique_ptr<IndexedViewHandler> handler, Local<Value> const& owner) {
+    auto view = newView(indexedViewTemplate(), handler.get(), owner);
+    addManagedResource(handler.get(), ValueHelper::unwrap(view), [](void* ptr) {
+        delete static_cast<IndexedViewHandler*>(ptr);
+    });
+    (void)handler.release(); // owned by the managed resource now
+    return view;
+}
+
+Local<Object> Engine::newNamedView(std::unique_ptr<NamedViewHandler> handler) {
+    return newNamedView(std::move(handler), Local<Value>{});
+}
+
+Local<Object> Engine::newNamedView(std::unique_ptr<NamedViewHandler> handler, Local<Value> const& owner) {
+    auto view = newView(namedViewTemplate(), handler.get(), owner);
+    addManagedResource(handler.get(), ValueHelper::unwrap(view), [](void* ptr) {
+        delete static_cast<NamedViewHandler*>(ptr);
+    });
+    (void)handler.release(); // owned by the managed resource now
+    return view;
+}
+
+Local<Object> Engine::newIterator(std::unique_ptr<IteratorHandler> handler) {
+    return newIterator(std::move(handler), Local<Value>{});
+}
+
+Local<Object> Engine::newIterator(std::unique_ptr<IteratorHandler> handler, Local<Value> const& owner) {
+    auto view = newView(iteratorTemplate()->InstanceTemplate(), handler.get(), owner);
+    addManagedResource(handler.get(), ValueHelper::unwrap(view), [](void* ptr) {
+        delete static_cast<IteratorHandler*>(ptr);
+    });
+    (void)handler.release(); // owned by the managed resource now
+    return view;
+}
+
 void Engine::setData(std::shared_ptr<void> data) { userData_ = std::move(data); }
 
 bool Engine::isDestroying() const { return isDestroying_; }
@@ -106,6 +501,69 @@ Local<Value> Engine::eval(Local<String> const& code, Local<String> const& source
     return ValueHelper::wrap<Value>(result.ToLocalChecked());
 }
 
+namespace {
+
+// JSON payloads from this size on are handed to the engine without copying them into the V8 heap
+constexpr size_t kExternalJsonThreshold = 16 * 1024;
+
+class ExternalJsonSource final : public v8::String::ExternalOneByteStringResource {
+public:
+    explicit ExternalJsonSource(std::string&& text) : text_(std::move(text)) {}
+
+    char const* data() const override { return text_.data(); }
+    size_t      length() const override { return text_.size(); }
+
+private:
+    std::string text_;
+};
+
+bool isAscii(std::string_view text) {
+    return std::all_of(text.begin(), text.end(), [](char c) { return static_cast<unsigned char>(c) < 0x80; });
+}
+
+} // namespace
+
+Local<Value> Engine::parseJson(std::string_view json) { return parseJson(ValueHelper::unwrap(String::newString(json))); }
+Local<Value> Engine::parseJson(char const* json) { return parseJson(std::string_view{json}); }
+
+Local<Value> Engine::parseJson(std::string&& json) {
+    // one-byte external strings are Latin-1, so only pure ASCII can be passed through as is
+    if (json.size() < kExternalJsonThreshold || !isAscii(json)) {
+        return parseJson(std::string_view{json});
+    }
+    auto                  resource = std::make_unique<ExternalJsonSource>(std::move(json));
+    v8::Local<v8::String> source;
+    if (!v8::String::NewExternalOneByte(isolate_, resource.get()).ToLocal(&source)) {
+        throw Exception{"Engine::parseJson: input is too long", Exception::Type::RangeError};
+    }
+    resource.release(); // owned by the string now, disposed by V8
+    return parseJson(source);
+}
+
+Local<Value> Engine::parseJson(v8::Local<v8::String> source) {
+    v8::TryCatch try_catch(isolate_);
+
+    auto result = v8::JSON::Parse(context_.Get(isolate_), source);
+    Exception::rethrow(try_catch);
+    return ValueHelper::wrap<Value>(result.ToLocalChecked());
+}
+
+std::string Engine::stringify(Local<Value> const& value) {
+    auto raw = ValueHelper::unwrap(value);
+    if (raw->IsUndefined() || raw->IsFunction() || raw->IsSymbol()) {
+        return {}; // v8::JSON::Stringify would give the text "undefined"
+    }
+    v8::TryCatch try_catch(isolate_);
+
+    auto result = v8::JSON::Stringify(context_.Get(isolate_), raw);
+    Exception::rethrow(try_catch);
+    auto text = ValueHelper::wrap<String>(result.ToLocalChecked()).getValue();
+    if (text == "undefined") {
+        return {}; // a toJSON() returning undefined, never valid JSON text
+    }
+    return text;
+}
+
 void Engine::loadFile(std::filesystem::path const& path) {
     if (isDestroying()) return;
     if (!std::filesystem::exists(path)) {
@@ -121,6 +579,390 @@ void Engine::loadFile(std::filesystem::path const& path) {
 
 void Engine::gc() const { isolate_->LowMemoryNotification(); }
 
+void Engine::setMicrotasksPolicy(MicrotasksPolicy policy) {
+    isolate_->SetMicrotasksPolicy(
+        policy == MicrotasksPolicy::kExplicit ? v8::MicrotasksPolicy::kExplicit : v8::MicrotasksPolicy::kAuto
+    );
+}
+
+MicrotasksPolicy Engine::microtasksPolicy() const {
+    return isolate_->GetMicrotasksPolicy() == v8::MicrotasksPolicy::kExplicit ? MicrotasksPolicy::kExplicit
+                                                                              : MicrotasksPolicy::kAuto;
+}
+
+void Engine::runMicrotasks() { isolate_->PerformMicrotaskCheckpoint(); }
+
+void Engine::TaskQueue::post(std::function<void()> task, bool completesPending) {
+    {
+        std::lock_guard lock{mutex_};
+        if (completesPending) {
+            --pending_;
+        }
+        if (!closed_) {
+            tasks_.push_back(std::move(task));
+        }
+    }
+    ready_.notify_one();
+}
+
+void Engine::TaskQueue::finishJob() {
+    {
+        std::lock_guard lock{mutex_};
+        --running_;
+    }
+    ready_.notify_all(); // the engine may be waiting in its destructor
+}
+
+void Engine::postTask(std::function<void()> task) { taskQueue_->post(std::move(task), false); }
+
+bool Engine::hasPendingTasks() const {
+    if (std::any_of(dueTimers_.begin(), dueTimers_.end(), [this](TimerId id) { return timers_.contains(id); })) {
+        return true; // left over by runFor / runOnce(deadline)
+    }
+    std::lock_guard lock{taskQueue_->mutex_};
+    return !taskQueue_->tasks_.empty();
+}
+
+size_t Engine::runOnce() { return runOnce(std::chrono::steady_clock::time_point::max()); }
+
+size_t Engine::runOnce(std::chrono::steady_clock::time_point deadline) {
+    auto report = runTick(deadline);
+    return report.timersRun + report.tasksRun;
+}
+
+TickReport Engine::runFor(std::chrono::steady_clock::duration budget) {
+    auto start  = clock_();
+    auto report = runTick(start + budget);
+
+    report.elapsed = clock_() - start;
+    report.overrun = std::max(report.elapsed - budget, std::chrono::steady_clock::duration::zero());
+
+    ++tickStats_.ticks;
+    if (report.overrun > std::chrono::steady_clock::duration::zero()) {
+        ++tickStats_.overruns;
+        tickStats_.totalOverrun += report.overrun;
+        tickStats_.worstOverrun  = std::max(tickStats_.worstOverrun, report.overrun);
+    }
+    return report;
+}
+
+TickStats const& Engine::tickStats() const { return tickStats_; }
+
+TickReport Engine::runTick(std::chrono::steady_clock::time_point deadline) {
+    expiredScratch_.clear();
+    timerWheel_.advance(clock_(), expiredScratch_);
+    dueTimers_.insert(dueTimers_.end(), expiredScratch_.begin(), expiredScratch_.end());
+
+    size_t queued;
+    {
+        std::lock_guard lock{taskQueue_->mutex_};
+        queued = taskQueue_->tasks_.size();
+    }
+
+    TickReport report;
+    bool       expired = false; // the deadline, checked after each callback so a tick always makes progress
+    auto       run     = [&](auto&& callback) {
+        {
+            v8::HandleScope handleScope{isolate_};
+            callback();
+        }
+        isolate_->PerformMicrotaskCheckpoint();
+        expired = clock_() >= deadline;
+    };
+
+    while (!expired && !dueTimers_.empty()) {
+        auto id = dueTimers_.front();
+        dueTimers_.pop_front();
+        if (!timers_.contains(id)) {
+            continue; // cleared after it expired
+        }
+        ++report.timersRun;
+        run([&] { runTimer(id); });
+    }
+    while (!expired && report.tasksRun < queued) {
+        std::function<void()> task;
+        {
+            std::lock_guard lock{taskQueue_->mutex_};
+            if (taskQueue_->tasks_.empty()) break;
+            task = std::move(taskQueue_->tasks_.front());
+            taskQueue_->tasks_.pop_front();
+        }
+        ++report.tasksRun;
+        run(task);
+    }
+    if (report.timersRun + report.tasksRun == 0) {
+        isolate_->PerformMicrotaskCheckpoint(); // reactions queued by native calls outside of tasks
+    }
+
+    report.carriedOver = static_cast<size_t>(
+        std::count_if(dueTimers_.begin(), dueTimers_.end(), [this](TimerId id) { return timers_.contains(id); })
+    );
+    report.carriedOver += queued - report.tasksRun;
+    return report;
+}
+
+void Engine::runLoop() {
+    for (;;) {
+        runOnce();
+        if (!dueTimers_.empty()) continue;
+
+        auto             wakeup = timerWheel_.nextWakeup();
+        std::unique_lock lock{taskQueue_->mutex_};
+        if (!taskQueue_->tasks_.empty()) continue;
+        if (taskQueue_->pending_ == 0 && !wakeup) break;
+        lock.unlock();
+
+        ExitEngineScope  unlocked; // async completions may need to enter the engine from their threads
+        std::unique_lock wait{taskQueue_->mutex_};
+        if (wakeup) {
+            // relative, the wakeup is on clock_ (see setClock)
+            taskQueue_->ready_.wait_for(wait, *wakeup - clock_(), [this] { return !taskQueue_->tasks_.empty(); });
+        } else {
+            taskQueue_->ready_.wait(wait, [this] {
+                return !taskQueue_->tasks_.empty() || taskQueue_->pending_ == 0;
+            });
+        }
+    }
+}
+
+TimerId Engine::setTimer(std::chrono::milliseconds delay, std::function<void()> callback, bool repeat) {
+    Timer timer;
+    timer.native_ = std::move(callback);
+    if (repeat) {
+        timer.interval_ = std::max(delay, std::chrono::milliseconds{1});
+    }
+    return addTimer(std::move(timer), delay);
+}
+
+TimerId Engine::addTimer(Timer timer, std::chrono::milliseconds delay) {
+    auto id         = nextTimerId_++;
+    timer.deadline_ = clock_() + std::max(delay, std::chrono::milliseconds::zero());
+    timerWheel_.schedule(id, timer.deadline_);
+    timers_.emplace(id, std::move(timer));
+    return id;
+}
+
+bool Engine::clearTimer(TimerId id) {
+    timerWheel_.cancel(id); // not on the wheel if it is due
+    return timers_.erase(id) != 0;
+}
+
+size_t Engine::activeTimers() const { return timers_.size(); }
+
+void Engine::setClock(std::function<std::chrono::steady_clock::time_point()> clock) {
+    if (!timers_.empty()) {
+        throw std::logic_error("setClock() with active timers");
+    }
+    clock_      = std::move(clock);
+    timerWheel_ = TimerWheel{clock_()};
+    dueTimers_.clear(); // only ids of cleared timers are left
+}
+
+void Engine::runTimer(TimerId id) {
+    auto iter = timers_.find(id);
+    if (iter == timers_.end()) {
+        return;
+    }
+    // the callback may clear any timer, this one included: nothing refers to the entry while it runs
+    std::function<void()>             native;
+    v8::Local<v8::Function>           script;
+    std::vector<v8::Local<v8::Value>> args;
+    auto&                             timer = iter->second;
+    if (timer.interval_.count() != 0) {
+        // keeps its cadence, a late tick fires once rather than catching up
+        timer.deadline_ = std::max(timer.deadline_ + timer.interval_, clock_());
+        timerWheel_.schedule(id, timer.deadline_);
+        native = timer.native_;
+    } else {
+        native = std::move(timer.native_);
+    }
+    if (!timer.script_.IsEmpty()) {
+        script = timer.script_.Get(isolate_);
+        args.reserve(timer.args_.size());
+        for (auto& arg : timer.args_) {
+            args.push_back(arg.Get(isolate_));
+        }
+    }
+    if (timer.interval_.count() == 0) {
+        timers_.erase(iter);
+    }
+
+    if (native) {
+        native();
+        return;
+    }
+    v8::TryCatch vtry{isolate_};
+    auto         ctx = context_.Get(isolate_);
+    (void)script->Call(ctx, v8::Undefined(isolate_), static_cast<int>(args.size()), args.data()).IsEmpty();
+    Exception::rethrow(vtry);
+}
+
+void Engine::installTimers() {
+    // data: whether the timer repeats
+    auto set = [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+        auto engine = EngineScope::currentEngine();
+        if (engine == nullptr) return;
+        auto isolate = info.GetIsolate();
+        auto ctx     = isolate->GetCurrentContext();
+        if (info.Length() < 1 || !info[0]->IsFunction()) {
+            Exception{"callback must be a function", Exception::Type::TypeError}.rethrowToRuntime();
+            return;
+        }
+        double delay = 0;
+        if (info.Length() > 1) {
+            auto number = info[1]->NumberValue(ctx);
+            if (number.IsNothing()) return; // valueOf threw
+            delay = number.FromJust();
+        }
+        // NaN and negative delays mean 0, browsers clamp to int32 too
+        auto ms = std::chrono::milliseconds{static_cast<int64_t>(std::min(delay > 0 ? delay : 0., 2147483647.))};
+
+        Timer timer;
+        timer.script_.Reset(isolate, info[0].As<v8::Function>());
+        for (int i = 2; i < info.Length(); ++i) {
+            timer.args_.emplace_back(isolate, info[i]);
+        }
+        if (info.Data()->IsTrue()) {
+            timer.interval_ = std::max(ms, std::chrono::milliseconds{1});
+        }
+        info.GetReturnValue().Set(static_cast<double>(engine->addTimer(std::move(timer), ms)));
+    };
+    auto clear = [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+        auto engine = EngineScope::currentEngine();
+        if (engine == nullptr || info.Length() < 1 || !info[0]->IsNumber()) return; // like browsers, ignore bad ids
+        double id = info[0].As<v8::Number>()->Value();
+        if (!(id >= 1 && id < 0x1p64)) return; // NaN, infinite or outside the TimerId range: no timer has it
+        (void)engine->clearTimer(static_cast<TimerId>(id));
+    };
+
+    auto ctx    = context_.Get(isolate_);
+    auto global = ctx->Global();
+    auto mount  = [&](char const* name, v8::FunctionCallback callback, bool repeat) {
+        auto function = v8::Function::New(ctx, callback, v8::Boolean::New(isolate_, repeat)).ToLocalChecked();
+        auto key      = v8::String::NewFromUtf8(isolate_, name, v8::NewStringType::kInternalized).ToLocalChecked();
+        function->SetName(key);
+        (void)global->Set(ctx, key, function).IsNothing();
+    };
+    mount("setTimeout", set, false);
+    mount("setInterval", set, true);
+    mount("clearTimeout", clear, false);
+    mount("clearInterval", clear, false);
+}
+
+void Engine::setWorkerPool(std::shared_ptr<WorkerPool> pool) { workerPool_ = std::move(pool); }
+
+WorkerPool& Engine::workerPool() {
+    if (!workerPool_) {
+        workerPool_ = std::make_shared<WorkerPool>();
+    }
+    return *workerPool_;
+}
+
+Local<Promise> Engine::runAsync(AsyncWork work, Local<Value> const& keepAlive) {
+    auto ctx      = context_.Get(isolate_);
+    auto resolver = v8::Promise::Resolver::New(ctx).ToLocalChecked();
+    auto promise  = resolver->GetPromise();
+    auto id       = nextAsyncCall_++;
+
+    CancellationToken token;
+    {
+        std::lock_guard lock{taskQueue_->mutex_};
+        ++taskQueue_->pending_;
+        ++taskQueue_->running_;
+    }
+    // the job only holds C++ state, the handles stay in asyncCalls_ on the engine thread
+    bool accepted = workerPool().trySubmit([this, queue = taskQueue_, id, token, work = std::move(work)]() mutable {
+        {
+            std::function<Local<Value>()> completion;
+            std::exception_ptr            error;
+            if (!token.isCancelled()) {
+                try {
+                    completion = work(token);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+            work = nullptr; // its arguments may borrow engine data, release them before the engine can go away
+            queue->post(
+                [this, id, completion = std::move(completion), error] { settleAsync(id, completion, error); },
+                true
+            );
+        }
+        queue->finishJob(); // the engine may be destroyed from here on
+    });
+    if (!accepted) {
+        {
+            std::lock_guard lock{taskQueue_->mutex_};
+            --taskQueue_->pending_;
+            --taskQueue_->running_;
+        }
+        Exception error{"worker pool queue is full", Exception::Type::RangeError};
+        (void)resolver->Reject(ctx, ValueHelper::unwrap(error.exception())).IsNothing();
+        return ValueHelper::wrap<Promise>(promise);
+    }
+    asyncCalls_.emplace(
+        id,
+        AsyncCall{
+            v8::Global<v8::Promise::Resolver>{isolate_, resolver},
+            v8::Global<v8::Value>{isolate_, ValueHelper::unwrap(keepAlive)},
+            token
+        }
+    );
+
+    auto cancel = v8::Function::New(
+        ctx,
+        [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+            auto engine = EngineScope::currentEngine();
+            auto callId = static_cast<uint64_t>(info.Data().As<v8::Number>()->Value());
+            info.GetReturnValue().Set(engine != nullptr && engine->cancelAsync(callId));
+        },
+        v8::Number::New(isolate_, static_cast<double>(id))
+    );
+    auto name = v8::String::NewFromUtf8Literal(isolate_, "cancel", v8::NewStringType::kInternalized);
+    (void)promise->Set(ctx, name, cancel.ToLocalChecked()).IsNothing();
+    return ValueHelper::wrap<Promise>(promise);
+}
+
+void Engine::settleAsync(uint64_t id, std::function<Local<Value>()> const& completion, std::exception_ptr error) {
+    auto iter = asyncCalls_.find(id);
+    if (iter == asyncCalls_.end()) {
+        return; // cancelled
+    }
+    auto call = std::move(iter->second);
+    asyncCalls_.erase(iter);
+
+    auto         ctx      = context_.Get(isolate_);
+    auto         resolver = call.resolver_.Get(isolate_);
+    v8::TryCatch vtry{isolate_};
+    try {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        (void)resolver->Resolve(ctx, ValueHelper::unwrap(completion())).IsNothing();
+    } catch (Exception const& e) {
+        (void)resolver->Reject(ctx, ValueHelper::unwrap(e.exception())).IsNothing();
+    } catch (std::exception const& e) {
+        Exception wrapped{e.what()};
+        (void)resolver->Reject(ctx, ValueHelper::unwrap(wrapped.exception())).IsNothing();
+    }
+    Exception::rethrow(vtry);
+}
+
+bool Engine::cancelAsync(uint64_t id) {
+    auto iter = asyncCalls_.find(id);
+    if (iter == asyncCalls_.end()) {
+        return false; // already settled
+    }
+    auto call = std::move(iter->second);
+    asyncCalls_.erase(iter);
+    call.token_.cancel();
+
+    Exception error{"async call cancelled"};
+    auto      resolver = call.resolver_.Get(isolate_);
+    (void)resolver->Reject(context_.Get(isolate_), ValueHelper::unwrap(error.exception())).IsNothing();
+    return true;
+}
+
 Local<Object> Engine::globalThis() const { return ValueHelper::wrap<Object>(context_.Get(isolate_)->Global()); }
 
 void Engine::addManagedResource(void* resource, v8::Local<v8::Value> value, std::function<void(void*)>&& deleter) {
@@ -160,6 +1002,18 @@ Local<Function> Engine::registerClass(ClassMeta const& meta) {
         throw std::logic_error("Class already registered: " + meta.name_);
     }
 
+    if (auto inlineSize = meta.instanceMeta_.inlineSize_; inlineSize != 0) {
+        if (inlineSize > InstanceMemberMeta::kMaxInlineSize) {
+            throw std::logic_error("Inline value class is too large: " + meta.name_);
+        }
+        if (meta.base_ != nullptr) {
+            throw std::logic_error("Inline value class cannot inherit: " + meta.name_);
+        }
+    }
+    if (meta.base_ != nullptr && meta.base_->instanceMeta_.inlineSize_ != 0) {
+        throw std::logic_error("Inline value class cannot be inherited: " + meta.base_->name_);
+    }
+
     v8::TryCatch vtry(isolate_);
 
     v8::Local<v8::FunctionTemplate> ctor; // js: new T()
@@ -211,8 +1065,14 @@ Local<Object> Engine::registerEnum(EnumMeta const& meta) {
     }
 
     auto object = Object::newObject();
-    for (auto const& [name, value] : meta.entries_) {
-        object.set(String::newString(name), Number::newNumber(static_cast<double>(value)));
+    for (size_t i = 0; i < meta.entries_.size(); ++i) {
+        auto const& [name, value] = meta.entries_[i];
+        if (meta.stringValues_) {
+            auto str = enumEntryName(meta, i);
+            object.set(str, str);
+        } else {
+            object.set(String::newString(name), Number::newNumber(static_cast<double>(value)));
+        }
     }
 
     (void)object.defineOwnProperty(
@@ -230,6 +1090,154 @@ Local<Object> Engine::registerEnum(EnumMeta const& meta) {
     return object;
 }
 
+Engine::EnumCache& Engine::getEnumCache(EnumMeta const& meta) {
+    if (auto iter = enumCaches_.find(&meta); iter != enumCaches_.end()) {
+        return iter->second;
+    }
+    EnumCache cache;
+    cache.names_.reserve(meta.entries_.size());
+    for (size_t i = 0; i < meta.entries_.size(); ++i) {
+        auto const& name = meta.entries_[i].name_;
+        auto        key  = v8::String::NewFromUtf8(
+            isolate_,
+            name.data(),
+            v8::NewStringType::kInternalized,
+            static_cast<int>(name.size())
+        );
+        auto str = key.ToLocalChecked();
+        cache.byHash_.emplace(str->GetIdentityHash(), i);
+        cache.names_.emplace_back(isolate_, str);
+    }
+    return enumCaches_.emplace(&meta, std::move(cache)).first->second;
+}
+
+Local<String> Engine::enumEntryName(EnumMeta const& meta, size_t index) {
+    auto& cache = getEnumCache(meta);
+    if (index >= cache.names_.size()) {
+        throw Exception{"Engine::enumEntryName: entry index out of range", Exception::Type::RangeError};
+    }
+    return ValueHelper::wrap<String>(cache.names_[index].Get(isolate_));
+}
+
+std::optional<size_t> Engine::enumEntryIndex(EnumMeta const& meta, Local<String> const& name) {
+    auto& cache = getEnumCache(meta);
+    auto  str   = ValueHelper::unwrap(name);
+    for (size_t i = 0; i < cache.names_.size(); ++i) {
+        if (cache.names_[i] == str) { // same internalized string, no handle is created
+            return i;
+        }
+    }
+    // not internalized (e.g. built at runtime): the string hash narrows it down, then compare contents in V8
+    auto [first, last] = cache.byHash_.equal_range(str->GetIdentityHash());
+    for (auto iter = first; iter != last; ++iter) {
+        if (str->StringEquals(cache.names_[iter->second].Get(isolate_))) {
+            return iter->second;
+        }
+    }
+    return std::nullopt;
+}
+
+
+namespace {
+
+// Inline values are split into Smi-sized chunks (one per internal field), so storing them never allocates.
+constexpr size_t kInlineChunkSize = v8::internal::SmiValuesAre32Bits() ? 4 : 3;
+
+int inlineValueFieldCount(size_t size) { return static_cast<int>((size + kInlineChunkSize - 1) / kInlineChunkSize); }
+
+/**
+ * @brief Non-owning view of the stack copy of an inline value, lives for one member call
+ */
+class InlineValueInstance final : public NativeInstance {
+public:
+    explicit InlineValueInstance(ClassMeta const* meta, void* data) : NativeInstance(meta), data_(data) {}
+
+    std::type_index type_id() const override { return meta_->typeId_; }
+
+    bool is_const() const override { return false; }
+
+    void* cast(std::type_index target_type) const override { return meta_->castTo(data_, target_type); }
+
+    std::unique_ptr<NativeInstance> clone() const override {
+        throw Exception("Inline value instances are copied by value, they cannot be cloned");
+    }
+
+    bool is_owned() const override { return false; }
+
+private:
+    void* data_;
+};
+
+} // namespace
+
+void Engine::storeInlineValue(
+    v8::Isolate*          isolate,
+    v8::Local<v8::Object> object,
+    void const*           data,
+    size_t                size,
+    void const*           previous
+) {
+    auto bytes = static_cast<unsigned char const*>(data);
+    auto old   = static_cast<unsigned char const*>(previous);
+    for (size_t offset = 0; offset < size; offset += kInlineChunkSize) {
+        size_t length = std::min(kInlineChunkSize, size - offset);
+        if (old && std::memcmp(bytes + offset, old + offset, length) == 0) {
+            continue; // unchanged
+        }
+        uint32_t chunk = 0;
+        for (size_t i = 0; i < length; ++i) {
+            chunk |= static_cast<uint32_t>(bytes[offset + i]) << (8 * i);
+        }
+        object->SetInternalField(
+            kInlineValueField + static_cast<int>(offset / kInlineChunkSize),
+            v8::Integer::New(isolate, static_cast<int32_t>(chunk))
+        );
+    }
+}
+
+bool Engine::loadInlineValue(v8::Local<v8::Object> object, void* out, size_t size) {
+    if (object->InternalFieldCount() < kInlineValueField + inlineValueFieldCount(size)) {
+        return false;
+    }
+    auto bytes = static_cast<unsigned char*>(out);
+    for (size_t offset = 0; offset < size; offset += kInlineChunkSize) {
+        auto field = object->GetInternalField(kInlineValueField + static_cast<int>(offset / kInlineChunkSize));
+        if (!field->IsValue() || !field.As<v8::Value>()->IsInt32()) {
+            return false; // constructor did not complete
+        }
+        auto   chunk  = static_cast<uint32_t>(field.As<v8::Value>().As<v8::Int32>()->Value());
+        size_t length = std::min(kInlineChunkSize, size - offset);
+        for (size_t i = 0; i < length; ++i) {
+            bytes[offset + i] = static_cast<unsigned char>(chunk >> (8 * i));
+        }
+    }
+    return true;
+}
+
+Local<Object> Engine::newInlineValue(ClassMeta const& meta, void const* data) {
+    if (meta.instanceMeta_.inlineSize_ == 0) {
+        [[unlikely]] throw std::logic_error{"Not an inline value class: " + meta.name_};
+    }
+    auto iter = classConstructors_.find(&meta);
+    if (iter == classConstructors_.end()) {
+        [[unlikely]] throw std::logic_error{"The native class " + meta.name_ + " is not registered."};
+    }
+    v8::TryCatch vtry{isolate_};
+    auto maybe = iter->second.Get(isolate_)->InstanceTemplate()->NewInstance(context_.Get(isolate_));
+    Exception::rethrow(vtry);
+
+    auto object = maybe.ToLocalChecked();
+    object->SetAlignedPointerInInternalField(static_cast<int>(InternalFieldSolt::InstancePayload), nullptr);
+    storeInlineValue(isolate_, object, data, meta.instanceMeta_.inlineSize_);
+    return ValueHelper::wrap<Object>(object);
+}
+
+bool Engine::readInlineValue(Local<Value> const& value, ClassMeta const& meta, void* out) const {
+    if (meta.instanceMeta_.inlineSize_ == 0 || !value.isObject() || !isInstanceOf(value.asObject(), meta)) {
+        return false;
+    }
+    return loadInlineValue(ValueHelper::unwrap(value.asObject()), out, meta.instanceMeta_.inlineSize_);
+}
 
 bool Engine::isInstanceOf(Local<Object> const& obj, ClassMeta const& meta) const {
     auto iter = classConstructors_.find(&meta);
@@ -265,6 +1273,100 @@ Local<Object> Engine::newInstance(ClassMeta const& meta, std::unique_ptr<NativeI
     return ValueHelper::wrap<Object>(val.ToLocalChecked());
 }
 
+namespace {
+
+/**
+ * @brief Payload storage of one Engine::newInstances batch, released together with the last wrapper
+ */
+struct InstancePayloadBlock {
+    std::allocator<InstancePayload> allocator;
+    InstancePayload*                payloads;
+    size_t                          capacity;
+    size_t                          alive{0};
+
+    explicit InstancePayloadBlock(size_t count) : payloads(allocator.allocate(count)), capacity(count) {}
+    ~InstancePayloadBlock() { allocator.deallocate(payloads, capacity); }
+
+    void release(InstancePayload* payload) {
+        std::destroy_at(payload);
+        if (--alive == 0) delete this;
+    }
+};
+
+} // namespace
+
+Local<Array> Engine::newInstances(std::vector<std::unique_ptr<NativeInstance>>&& instances) {
+    return newInstances(std::move(instances), Local<Value>{});
+}
+
+Local<Array>
+Engine::newInstances(std::vector<std::unique_ptr<NativeInstance>>&& instances, Local<Value> const& parent) {
+    v8::TryCatch vtry{isolate_};
+    auto         ctx = context_.Get(isolate_);
+
+    v8::Local<v8::Object> v8Parent;
+    if (parent.isObject() && getInstancePayload(parent.asObject())) {
+        v8Parent = ValueHelper::unwrap(parent.asObject());
+    }
+
+    std::vector<v8::Local<v8::Value>> elements;
+    elements.reserve(instances.size());
+
+    auto* block = new InstancePayloadBlock{std::max<size_t>(instances.size(), 1)};
+    try {
+        ClassMeta const*              lastMeta = nullptr;
+        v8::Local<v8::ObjectTemplate> tmpl;
+        for (auto& instance : instances) {
+            if (!instance) {
+                elements.push_back(v8::Null(isolate_));
+                continue;
+            }
+            auto meta = instance->meta();
+            if (meta != lastMeta) {
+                auto iter = meta ? classConstructors_.find(meta) : classConstructors_.end();
+                if (iter == classConstructors_.end()) {
+                    [[unlikely]] throw std::logic_error{"The native class is not registered, cannot wrap instances."};
+                }
+                tmpl = iter->second.Get(isolate_)->InstanceTemplate();
+                if (tmpl->InternalFieldCount() < static_cast<int>(InternalFieldSolt::Count)) {
+                    [[unlikely]] throw std::logic_error{
+                        "The native class " + meta->name_ + " has no constructor, so an instance cannot be constructed."
+                    };
+                }
+                lastMeta = meta;
+            }
+
+            auto maybe = tmpl->NewInstance(ctx);
+            Exception::rethrow(vtry);
+            auto object = maybe.ToLocalChecked();
+
+            if (auto inlineSize = meta->instanceMeta_.inlineSize_; inlineSize != 0) {
+                object->SetAlignedPointerInInternalField(static_cast<int>(InternalFieldSolt::InstancePayload), nullptr);
+                storeInlineValue(isolate_, object, instance->cast(meta->typeId_), inlineSize);
+                elements.push_back(object);
+                continue;
+            }
+
+            auto payload = std::construct_at(block->payloads + block->alive, std::move(instance), meta, this, false);
+            ++block->alive;
+            object->SetAlignedPointerInInternalField(static_cast<int>(InternalFieldSolt::InstancePayload), payload);
+            if (!v8Parent.IsEmpty()) {
+                object->SetInternalField(static_cast<int>(InternalFieldSolt::ParentClassThisRef), v8Parent);
+            }
+            addManagedResource(payload, object, [block](void* payload) {
+                block->release(static_cast<InstancePayload*>(payload));
+            });
+            elements.push_back(object);
+        }
+    } catch (...) {
+        if (block->alive == 0) delete block;
+        throw;
+    }
+    if (block->alive == 0) delete block;
+
+    return ValueHelper::wrap<Array>(v8::Array::New(isolate_, elements.data(), elements.size()));
+}
+
 InstancePayload* Engine::getInstancePayload(Local<Object> const& obj) const {
     auto v8This = ValueHelper::unwrap(obj);
     if (v8This->InternalFieldCount() < (int)InternalFieldSolt::Count) {
@@ -369,6 +1471,17 @@ v8::Local<v8::FunctionTemplate> Engine::newConstructor(ClassMeta const& meta) {
                     }
                 }
 
+                if (auto inlineSize = meta->instanceMeta_.inlineSize_; inlineSize != 0) {
+                    // inline value: keep a copy of the bytes, the native instance is released right away
+                    // (no payload, the slot must read as nullptr rather than undefined)
+                    info.This()->SetAlignedPointerInInternalField(
+                        static_cast<int>(InternalFieldSolt::InstancePayload),
+                        nullptr
+                    );
+                    storeInlineValue(runtime->isolate_, info.This(), instance->cast(meta->typeId_), inlineSize);
+                    return;
+                }
+
                 auto payload = new InstancePayload{std::move(instance), meta, runtime, constructFromJs};
                 info.This()->SetAlignedPointerInInternalField(
                     static_cast<int>(InternalFieldSolt::InstancePayload),
@@ -396,7 +1509,9 @@ v8::Local<v8::FunctionTemplate> Engine::newConstructor(ClassMeta const& meta) {
         },
         data
     );
-    ctor->InstanceTemplate()->SetInternalFieldCount(static_cast<int>(InternalFieldSolt::Count));
+    ctor->InstanceTemplate()->SetInternalFieldCount(
+        static_cast<int>(InternalFieldSolt::Count) + inlineValueFieldCount(meta.instanceMeta_.inlineSize_)
+    );
     return ctor;
 }
 
@@ -464,8 +1579,90 @@ void Engine::buildStaticMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMeta
         obj->Set(ValueHelper::unwrap(scriptFunctionName).As<v8::Name>(), fn, v8::PropertyAttribute::DontDelete);
     }
 }
+namespace {
+
+using BulkPropertyList = std::span<InstanceMemberMeta::Property const* const>;
+
+// $assign(source): sets every writable property present on `source` in one native call, returns this
+Local<Value> assignProperties(
+    Engine&          engine,
+    BulkPropertyList props,
+    ShapeMeta const& shape,
+    InstancePayload& payload,
+    Arguments const& args
+) {
+    if (args.length() != 1 || !args[0].isObject()) {
+        throw Exception{"$assign expects an object", Exception::Type::TypeError};
+    }
+
+    // read-only properties are not looked up, so that $assign($snapshot()) round-trips
+    std::vector<size_t>        writable;
+    std::vector<Local<String>> keys;
+    writable.reserve(props.size());
+    keys.reserve(props.size());
+    for (size_t i = 0; i < props.size(); ++i) {
+        if (props[i]->setter_) {
+            writable.push_back(i);
+            keys.push_back(engine.shapeKey(shape, i));
+        }
+    }
+    std::vector<Local<Value>> values(keys.size());
+    args[0].asObject().getMany(keys, values);
+
+    for (size_t i = 0; i < writable.size(); ++i) {
+        if (!values[i].isUndefined()) { // absent
+            props[writable[i]]->setter_(payload, values[i]);
+        }
+    }
+    return args.thiz();
+}
+
+// $snapshot(): every property read into a plain object of the cached property shape
+Local<Value> snapshotProperties(
+    Engine&          engine,
+    BulkPropertyList props,
+    ShapeMeta const& shape,
+    InstancePayload& payload,
+    Arguments const& args
+) {
+    std::vector<Local<Value>> values;
+    values.reserve(props.size());
+    for (auto const* prop : props) {
+        values.push_back(prop->getter_(payload, args));
+    }
+    return engine.newObject(shape, values);
+}
+
+} // namespace
+
+Engine::BulkProperties const& Engine::newBulkProperties(ClassMeta const& meta) {
+    std::vector<ClassMeta const*> chain; // root first, so base properties keep their place in snapshots
+    for (auto cls = &meta; cls != nullptr; cls = cls->base_) {
+        chain.insert(chain.begin(), cls);
+    }
+    std::vector<InstanceMemberMeta::Property const*> properties;
+    std::vector<std::string>                         names;
+    std::unordered_map<std::string_view, size_t>     slots; // name -> index, views into the metas
+    for (auto cls : chain) {
+        for (auto const& prop : cls->instanceMeta_.property_) {
+            auto [iter, inserted] = slots.try_emplace(prop.name_, properties.size());
+            if (!inserted) {
+                properties[iter->second] = &prop; // redeclared by a derived class
+                continue;
+            }
+            names.push_back(prop.name_);
+            properties.push_back(&prop);
+        }
+    }
+    return bulkProperties_.emplace_back(BulkProperties{std::move(properties), ShapeMeta{std::move(names)}});
+}
+
 void Engine::buildInstanceMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMeta const& meta) {
     auto& instanceMeta = meta.instanceMeta_;
+    if (instanceMeta.inlineSize_ != 0) {
+        buildInlineValueMembers(obj, meta);
+        return;
+    }
 
     auto prototype = obj->PrototypeTemplate();
     auto signature = v8::Signature::New(isolate_);
@@ -546,10 +1743,9 @@ void Engine::buildInstanceMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMet
                         static_cast<int>(InternalFieldSolt::InstancePayload)
                     );
 
-                    auto typed  = static_cast<InstancePayload*>(wrapped);
-                    auto engine = const_cast<Engine*>(typed->engine_);
+                    auto typed = static_cast<InstancePayload*>(wrapped);
                     try {
-                        (prop->setter_)(*typed, Arguments{engine, info});
+                        (prop->setter_)(*typed, ValueHelper::wrap<Value>(info[0]));
                     } catch (Exception const& e) {
                         e.rethrowToRuntime();
                     }
@@ -566,7 +1762,149 @@ void Engine::buildInstanceMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMet
             v8::PropertyAttribute::DontDelete
         );
     }
+
+    if (instanceMeta.property_.empty()) {
+        return;
+    }
+    // mount "$assign" / "$snapshot", a derived prototype hides the base ones so they cover inherited properties too
+    using BulkMember =
+        Local<Value> (*)(Engine&, BulkPropertyList, ShapeMeta const&, InstancePayload&, Arguments const&);
+    auto& bulkData   = newBulkProperties(meta);
+    auto  mountBulk  = [&]<BulkMember bulk>(std::string_view name) {
+        prototype->Set(
+            ValueHelper::unwrap(String::newString(name)),
+            v8::FunctionTemplate::New(
+                isolate_,
+                [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                    auto data    = static_cast<BulkProperties const*>(info.Data().As<v8::External>()->Value());
+                    auto payload = info.This()->GetAlignedPointerFromInternalField(
+                        static_cast<int>(InternalFieldSolt::InstancePayload)
+                    );
+
+                    auto typed  = static_cast<InstancePayload*>(payload);
+                    auto engine = const_cast<Engine*>(typed->engine_);
+                    try {
+                        auto val = bulk(*engine, data->properties_, data->shape_, *typed, Arguments{engine, info});
+                        info.GetReturnValue().Set(ValueHelper::unwrap(val));
+                    } catch (Exception const& e) {
+                        e.rethrowToRuntime();
+                    }
+                },
+                v8::External::New(isolate_, const_cast<BulkProperties*>(&bulkData)),
+                signature
+            ),
+            static_cast<PropertyAttribute>(v8::PropertyAttribute::DontDelete | v8::PropertyAttribute::DontEnum)
+        );
+    };
+    mountBulk.template operator()<&assignProperties>("$assign");
+    mountBulk.template operator()<&snapshotProperties>("$snapshot");
+}
+
+template <typename Fn>
+void Engine::invokeInlineMember(v8::FunctionCallbackInfo<v8::Value> const& info, Fn&& fn) {
+    auto member = static_cast<InlineMember*>(info.Data().As<v8::External>()->Value());
+    auto size   = member->meta_->instanceMeta_.inlineSize_;
+
+    // the member runs on a stack copy, only the chunks it changed are written back
+    alignas(std::max_align_t) std::array<unsigned char, InstanceMemberMeta::kMaxInlineSize> value{};
+    alignas(std::max_align_t) std::array<unsigned char, InstanceMemberMeta::kMaxInlineSize> original{};
+    try {
+        if (!loadInlineValue(info.This(), value.data(), size)) {
+            throw Exception{"Accessing an uninitialized inline value", Exception::Type::TypeError};
+        }
+        original = value;
+
+        InlineValueInstance instance{member->meta_, value.data()};
+        InstancePayload     payload{instance, member->meta_, member->engine_};
+
+        Local<Value> result = fn(*member, payload);
+        storeInlineValue(info.GetIsolate(), info.This(), value.data(), size, original.data());
+        info.GetReturnValue().Set(ValueHelper::unwrap(result));
+    } catch (Exception const& e) {
+        e.rethrowToRuntime();
+    }
 }
 
+void Engine::buildInlineValueMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMeta const& meta) {
+    auto& instanceMeta = meta.instanceMeta_;
+
+    auto prototype = obj->PrototypeTemplate();
+    auto signature = v8::Signature::New(isolate_, obj); // the receiver always carries the inline value fields
+
+    auto newMember = [&](void const* member, v8::FunctionCallback callback) {
+        auto& data = inlineMembers_.emplace_back(InlineMember{this, &meta, member});
+        return v8::FunctionTemplate::New(isolate_, callback, v8::External::New(isolate_, &data), signature);
+    };
+
+    for (auto& method : instanceMeta.methods_) {
+        auto fn = newMember(&method, [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+            invokeInlineMember(info, [&info](InlineMember const& member, InstancePayload& payload) {
+                auto method = static_cast<InstanceMemberMeta::Method const*>(member.member_);
+                return (method->callback_)(payload, Arguments{member.engine_, info});
+            });
+        });
+        prototype->Set(ValueHelper::unwrap(String::newString(method.name_)), fn, v8::PropertyAttribute::DontDelete);
+    }
+
+    for (auto& prop : instanceMeta.property_) {
+        auto v8Getter = newMember(&prop, [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+            invokeInlineMember(info, [&info](InlineMember const& member, InstancePayload& payload) {
+                auto prop = static_cast<InstanceMemberMeta::Property const*>(member.member_);
+                return (prop->getter_)(payload, Arguments{member.engine_, info});
+            });
+        });
+        v8::Local<v8::FunctionTemplate> v8Setter;
+        if (prop.setter_) {
+            v8Setter = newMember(&prop, [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                invokeInlineMember(info, [&info](InlineMember const& member, InstancePayload& payload) {
+                    auto prop = static_cast<InstanceMemberMeta::Property const*>(member.member_);
+                    (prop->setter_)(payload, ValueHelper::wrap<Value>(info[0]));
+                    return Local<Value>{};
+                });
+            });
+        }
+        prototype->SetAccessorProperty(
+            ValueHelper::unwrap(String::newString(prop.name_)).As<v8::Name>(),
+            v8Getter,
+            v8Setter,
+            v8::PropertyAttribute::DontDelete
+        );
+    }
+
+    if (instanceMeta.property_.empty()) {
+        return;
+    }
+    auto& bulkData = newBulkProperties(meta);
+    auto  bulkAttributes =
+        static_cast<PropertyAttribute>(v8::PropertyAttribute::DontDelete | v8::PropertyAttribute::DontEnum);
+    prototype->Set(
+        ValueHelper::unwrap(String::newString("$assign")),
+        newMember(
+            &bulkData,
+            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                invokeInlineMember(info, [&info](InlineMember const& member, InstancePayload& payload) {
+                    auto data = static_cast<BulkProperties const*>(member.member_);
+                    Arguments args{member.engine_, info};
+                    return assignProperties(*member.engine_, data->properties_, data->shape_, payload, args);
+                });
+            }
+        ),
+        bulkAttributes
+    );
+    prototype->Set(
+        ValueHelper::unwrap(String::newString("$snapshot")),
+        newMember(
+            &bulkData,
+            [](v8::FunctionCallbackInfo<v8::Value> const& info) {
+                invokeInlineMember(info, [&info](InlineMember const& member, InstancePayload& payload) {
+                    auto data = static_cast<BulkProperties const*>(member.member_);
+                    Arguments args{member.engine_, info};
+                    return snapshotProperties(*member.engine_, data->properties_, data->shape_, payload, args);
+                });
+            }
+        ),
+        bulkAttributes
+    );
+}
 
-} // namespace v8kit
\ No newline at end of file
+} // namespace v8kit
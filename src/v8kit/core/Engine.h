@@ -1,18 +1,69 @@
 #pragma once
 #include "Fwd.h"
+#include "MetaInfo.h"
+#include "TimerWheel.h"
+#include "WorkerPool.h"
 #include "v8kit/Macro.h"
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
 #include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+V8KIT_WARNING_GUARD_BEGIN
+#include <v8-promise.h>
+#include <v8-template.h>
+V8KIT_WARNING_GUARD_END
 
 namespace v8kit {
 
-struct ClassMeta; // forward declaration
-struct EnumMeta;
+class IndexedViewHandler; // forward declaration
+class NamedViewHandler;
+class IteratorHandler;
 namespace internal {
 class V8EscapeScope;
 }
 
+/**
+ * When promise reactions (microtasks) run
+ */
+enum class MicrotasksPolicy : uint8_t {
+    kAuto,     // V8 default: whenever the script call depth drops to zero, i.e. after every native -> script call
+    kExplicit, // only in Engine::runMicrotasks() / runOnce(), one checkpoint per macrotask
+};
+
+/**
+ * What one Engine::runFor() did
+ */
+struct TickReport {
+    size_t                              timersRun{0};
+    size_t                              tasksRun{0};
+    size_t                              carriedOver{0}; // due timers and queued tasks left for the next tick
+    std::chrono::steady_clock::duration elapsed{0};
+    std::chrono::steady_clock::duration overrun{0}; // time spent past the budget, zero if it was met
+};
+
+/**
+ * Deadline overruns accumulated over every Engine::runFor()
+ */
+struct TickStats {
+    uint64_t                            ticks{0};
+    uint64_t                            overruns{0}; // ticks that exceeded their budget
+    std::chrono::steady_clock::duration totalOverrun{0};
+    std::chrono::steady_clock::duration worstOverrun{0};
+};
+
 class Engine {
 public:
     V8KIT_DISABLE_COPY(Engine);
@@ -45,8 +96,128 @@ public:
 
     void loadFile(std::filesystem::path const& path);
 
+    /**
+     * Parse JSON text with v8::JSON::Parse, malformed input throws a SyntaxError.
+     * @note the text is copied into the engine; hand over a std::string to avoid the copy for large payloads
+     */
+    Local<Value> parseJson(std::string_view json);
+    Local<Value> parseJson(char const* json);
+
+    /**
+     * @note large ASCII payloads become an external string that takes over the buffer (no copy into the V8 heap),
+     *       it is released when the engine no longer needs the source text
+     */
+    Local<Value> parseJson(std::string&& json);
+
+    /**
+     * JSON.stringify through v8::JSON::Stringify (toJSON and cycle errors behave like in script)
+     * @note values that JSON.stringify maps to undefined (undefined, functions, symbols, toJSON() returning
+     *       undefined) give an empty string
+     */
+    [[nodiscard]] std::string stringify(Local<Value> const& value);
+
     void gc() const;
 
+    /**
+     * Engines start with MicrotasksPolicy::kAuto (external isolates keep their own policy).
+     * @note with kExplicit, any number of native -> script calls share one batched checkpoint
+     */
+    void setMicrotasksPolicy(MicrotasksPolicy policy);
+
+    [[nodiscard]] MicrotasksPolicy microtasksPolicy() const;
+
+    /**
+     * Run all pending microtasks now (requires an EngineScope)
+     */
+    void runMicrotasks();
+
+    /**
+     * Queue a macrotask. Thread-safe: may be called from any thread, without an EngineScope.
+     * The task runs inside the engine's scope during runOnce() / runLoop().
+     */
+    void postTask(std::function<void()> task);
+
+    /**
+     * @return true if the next tick has work right away: a queued task, or a due timer carried over by a deadline
+     * @note timers that are not due yet and async calls still running do not count (see runLoop)
+     */
+    [[nodiscard]] bool hasPendingTasks() const;
+
+    /**
+     * One event loop tick (requires an EngineScope): run the due timers, then the tasks queued before the call,
+     * each in its own HandleScope and followed by a microtask checkpoint, and stop early once `deadline` has passed.
+     * Tasks posted during the tick wait for the next one, so the latency of a tick is bounded by its queue.
+     * Timers and tasks left over by the deadline run first in the next tick.
+     * @return number of timers and tasks run
+     * @note an exception thrown by a timer or task propagates, the ones after it stay queued
+     * @note `deadline` is a point on the engine clock, which is std::chrono::steady_clock unless setClock() replaced it
+     */
+    size_t runOnce();
+    size_t runOnce(std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * A tick that stops once `budget` is used up (see runOnce), for hosts running scripts in a fixed time slice.
+     * A single callback cannot be interrupted, so the budget may be overrun by the longest one: the report and
+     * tickStats() record by how much.
+     */
+    TickReport runFor(std::chrono::steady_clock::duration budget);
+
+    [[nodiscard]] TickStats const& tickStats() const;
+
+    /**
+     * Run ticks until no task, timer or async call is left (requires an EngineScope), so an interval that is never
+     * cleared keeps it running. While it waits the engine is unlocked, so other threads may enter it.
+     */
+    void runLoop();
+
+    /**
+     * Call `callback` on the engine thread after `delay`, and then every `delay` if `repeat` (at least 1ms).
+     * Timers fire from runOnce() / runFor() / runLoop(); the deadlines are kept on a timing wheel with millisecond
+     * resolution, so setting and clearing one is O(1).
+     * @return id for clearTimer(), never 0
+     * @note engine thread only, like the other members
+     */
+    TimerId setTimer(std::chrono::milliseconds delay, std::function<void()> callback, bool repeat = false);
+
+    /**
+     * @return false if `id` is not an active timer (already fired or cleared)
+     */
+    bool clearTimer(TimerId id);
+
+    [[nodiscard]] size_t activeTimers() const;
+
+    /**
+     * Replace the clock behind timers and tick budgets (std::chrono::steady_clock::now by default), e.g. a host's
+     * frame clock or a manual one in tests. runOnce(deadline) then takes deadlines on this clock, runFor() measures
+     * its budget with it, and runLoop() still sleeps in real time until the next deadline.
+     * @throws std::logic_error if a timer is active, deadlines already scheduled would mix both time bases
+     */
+    void setClock(std::function<std::chrono::steady_clock::time_point()> clock);
+
+    /**
+     * Mount setTimeout / setInterval / clearTimeout / clearInterval on globalThis (requires an EngineScope),
+     * backed by setTimer(). Not done by default so embedders that bring their own timers keep them.
+     */
+    void installTimers();
+
+    /**
+     * Replace the pool that runs async calls (may be shared between engines).
+     * By default each engine creates a WorkerPool on its first async call.
+     */
+    void setWorkerPool(std::shared_ptr<WorkerPool> pool);
+
+    [[nodiscard]] WorkerPool& workerPool();
+
+    /**
+     * Run `work` on the worker pool and settle a promise with its outcome on the engine thread: the completion
+     * returned by `work` runs as a task (runOnce / runLoop), exceptions of either reject the promise.
+     * The promise gets a `cancel()` method that rejects it at once and cancels the token passed to `work`.
+     * @param keepAlive kept alive until the call settles, e.g. the objects `work` refers to
+     * @note a full pool queue rejects the promise with a RangeError (backpressure)
+     * @note `work` must not hold script handles, it is run and destroyed on a worker thread
+     */
+    Local<Promise> runAsync(AsyncWork work, Local<Value> const& keepAlive);
+
     [[nodiscard]] Local<Object> globalThis() const;
 
     /**
@@ -65,28 +236,190 @@ public:
 
     Local<Object> registerEnum(EnumMeta const& meta);
 
+    /**
+     * @return the internalized name of entry `index` of `meta` (cached per engine)
+     */
+    [[nodiscard]] Local<String> enumEntryName(EnumMeta const& meta, size_t index);
+
+    /**
+     * Find the entry of `meta` named `name` without extracting the string: handles are compared by identity against
+     * the cached internalized names first (script literals are internalized), then by content within a hash bucket.
+     * @return entry index, std::nullopt if no entry has that name
+     */
+    [[nodiscard]] std::optional<size_t> enumEntryIndex(EnumMeta const& meta, Local<String> const& name);
+
     [[nodiscard]] ClassMeta const* getClassMeta(std::type_index typeId) const;
 
     Local<Object> newInstance(ClassMeta const& meta, std::unique_ptr<NativeInstance>&& instance);
 
+    /**
+     * Wrap a batch of native instances into one array.
+     * Wrappers are instantiated straight from the instance template (no constructor call),
+     * payloads share one allocation and the array is created in one step. null entries become null.
+     * @param parent if it is a native instance, every wrapper keeps it alive (ReturnValuePolicy::kReferenceInternal)
+     */
+    Local<Array> newInstances(std::vector<std::unique_ptr<NativeInstance>>&& instances);
+    Local<Array> newInstances(std::vector<std::unique_ptr<NativeInstance>>&& instances, Local<Value> const& parent);
+
+    /**
+     * Create a wrapper of an inline value class (InstanceMemberMeta::inlineSize_ != 0).
+     * The bytes at `data` are copied into the wrapper's internal fields: nothing is allocated on the C++ heap and no
+     * finalizer is registered. Methods run on a stack copy that is written back when they return.
+     */
+    Local<Object> newInlineValue(ClassMeta const& meta, void const* data);
+
+    /**
+     * Copy the bytes of an inline value wrapper into `out` (meta.instanceMeta_.inlineSize_ bytes)
+     * @return false if `value` is not an instance of `meta`
+     */
+    [[nodiscard]] bool readInlineValue(Local<Value> const& value, ClassMeta const& meta, void* out) const;
+
     [[nodiscard]] bool isInstanceOf(Local<Object> const& obj, ClassMeta const& meta) const;
 
     [[nodiscard]] InstancePayload* getInstancePayload(Local<Object> const& obj) const;
 
     [[nodiscard]] bool trySetReferenceInternal( Local<Object> const& parentObj, Local<Object> const& subObj);
 
+    /**
+     * Create a plain object with the layout described by `shape`.
+     * Backed by a per-engine cached v8::DictionaryTemplate, so all objects of one shape share a hidden class.
+     * @param values one value per field, in ShapeMeta::fields_ order
+     */
+    Local<Object> newObject(ShapeMeta const& shape, std::span<const Local<Value>> values);
+
+    /**
+     * @return the internalized key of field `index` of `shape` (cached per engine)
+     */
+    [[nodiscard]] Local<String> shapeKey(ShapeMeta const& shape, size_t index);
+
+    /**
+     * @return the internalized string of a Key<...> literal, created on first use and cached per engine by `id`
+     * @note use Key<"name"> / "name"_key (Key.h) rather than calling this directly
+     */
+    [[nodiscard]] Local<String> keyLiteral(size_t id, std::string_view text);
+
+    /**
+     * Create an array-like object backed by `handler` (indexed interceptors, nothing is copied).
+     * It has a live `length` and is iterable; the handler is destroyed together with the object.
+     * @param owner kept alive as long as the view, e.g. the native instance owning the container
+     */
+    Local<Object> newIndexedView(std::unique_ptr<IndexedViewHandler> handler);
+    Local<Object> newIndexedView(std::unique_ptr<IndexedViewHandler> handler, Local<Value> const& owner);
+
+    /**
+     * Create a dictionary-like object backed by `handler` (named interceptors, string keys only).
+     * @param owner kept alive as long as the view
+     */
+    Local<Object> newNamedView(std::unique_ptr<NamedViewHandler> handler);
+    Local<Object> newNamedView(std::unique_ptr<NamedViewHandler> handler, Local<Value> const& owner);
+
+    /**
+     * Create an iterator object (`next()`, `return()`, `[Symbol.iterator]`) that pulls values from `handler` on demand.
+     * @param owner kept alive as long as the iterator
+     */
+    Local<Object> newIterator(std::unique_ptr<IteratorHandler> handler);
+    Local<Object> newIterator(std::unique_ptr<IteratorHandler> handler, Local<Value> const& owner);
+
 private:
     void setToStringTag(v8::Local<v8::FunctionTemplate>& obj, std::string_view name, bool hasConstructor);
     void setToStringTag(v8::Local<v8::Object>& obj, std::string_view name);
 
     v8::Local<v8::FunctionTemplate> newConstructor(ClassMeta const& meta);
 
+    Local<Value> parseJson(v8::Local<v8::String> source);
+
+    // Object.prototype of this context, cached for bulk object construction
+    v8::Local<v8::Value> objectPrototype();
+
+    struct ShapeCache {
+        v8::Global<v8::DictionaryTemplate>   template_;
+        std::vector<v8::Global<v8::String>> keys_;
+    };
+    ShapeCache& getShapeCache(ShapeMeta const& shape);
+
+    struct EnumCache {
+        std::vector<v8::Global<v8::String>>  names_;  // per entry, internalized
+        std::unordered_multimap<int, size_t> byHash_; // string hash -> entry index
+    };
+    EnumCache& getEnumCache(EnumMeta const& meta);
+
+    // `view` is the holder of the interceptor / accessor, a receiver may be any object inheriting from it
+    static void*                  viewHandler(v8::Local<v8::Object> const& view);
+    v8::Local<v8::ObjectTemplate> indexedViewTemplate();
+    v8::Local<v8::ObjectTemplate> namedViewTemplate();
+    v8::Local<v8::FunctionTemplate> iteratorTemplate();
+    Local<Object> newView(v8::Local<v8::ObjectTemplate> tmpl, void* handler, Local<Value> const& owner);
+
     void buildStaticMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMeta const& meta);
     void buildInstanceMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMeta const& meta);
+    void buildInlineValueMembers(v8::Local<v8::FunctionTemplate>& obj, ClassMeta const& meta);
+
+    // copy `size` bytes into / out of the inline value fields; chunks equal to `previous` are not rewritten
+    static void storeInlineValue(
+        v8::Isolate*          isolate,
+        v8::Local<v8::Object> object,
+        void const*           data,
+        size_t                size,
+        void const*           previous = nullptr
+    );
+    static bool loadInlineValue(v8::Local<v8::Object> object, void* out, size_t size);
+
+    struct InlineMember {
+        Engine*          engine_;
+        ClassMeta const* meta_;
+        void const*      member_; // InstanceMemberMeta::Method / Property, BulkProperties for $assign / $snapshot
+    };
+    // fn(InlineMember const&, InstancePayload&) -> Local<Value>, run against a stack copy of the receiver
+    template <typename Fn>
+    static void invokeInlineMember(v8::FunctionCallbackInfo<v8::Value> const& info, Fn&& fn);
+
+    // what $assign / $snapshot cover: own and inherited properties, a derived one hides a base one of the same name
+    struct BulkProperties {
+        std::vector<InstanceMemberMeta::Property const*> properties_;
+        ShapeMeta                                         shape_;
+    };
+    BulkProperties const& newBulkProperties(ClassMeta const& meta);
+
+    struct TaskQueue {
+        std::mutex                        mutex_;
+        std::condition_variable           ready_;
+        std::deque<std::function<void()>> tasks_;
+        size_t                            pending_{0}; // async calls that will post a completion
+        size_t                            running_{0}; // async jobs not finished yet, they may use engine data
+        bool                              closed_{false};
+
+        // thread-safe, a closed queue drops the task
+        void post(std::function<void()> task, bool completesPending);
+
+        // called by an async job as its very last step
+        void finishJob();
+    };
+
+    struct AsyncCall {
+        v8::Global<v8::Promise::Resolver> resolver_;
+        v8::Global<v8::Value>             keepAlive_;
+        CancellationToken                 token_;
+    };
+    void settleAsync(uint64_t id, std::function<Local<Value>()> const& completion, std::exception_ptr error);
+    bool cancelAsync(uint64_t id);
+
+    struct Timer {
+        std::function<void()>                 native_;
+        v8::Global<v8::Function>              script_; // set by setTimeout / setInterval instead of native_
+        std::vector<v8::Global<v8::Value>>    args_;
+        std::chrono::steady_clock::time_point deadline_;
+        std::chrono::milliseconds             interval_{0}; // repeating if non-zero
+    };
+    TimerId addTimer(Timer timer, std::chrono::milliseconds delay);
+    void    runTimer(TimerId id);
+
+    TickReport runTick(std::chrono::steady_clock::time_point deadline);
 
     friend EngineScope;
     friend ExitEngineScope;
     friend internal::V8EscapeScope;
+    friend class Object;
+    friend class Snapshot;
 
     template <typename>
     friend class Global;
@@ -104,6 +437,11 @@ private:
         ParentClassThisRef = 1, // for ReturnValuePolicy::kReferenceInternal
         Count,
     };
+    // Views leave the InstancePayload slot empty (so they are never taken for instances),
+    // keep their owner in ParentClassThisRef and the handler in the slot after it.
+    static constexpr int kViewHandlerField = static_cast<int>(InternalFieldSolt::Count);
+    // Inline values leave the InstancePayload slot empty too, their bytes start at this slot.
+    static constexpr int kInlineValueField = static_cast<int>(InternalFieldSolt::Count);
 
     v8::Isolate*            isolate_{nullptr};
     v8::Global<v8::Context> context_{};
@@ -115,6 +453,8 @@ private:
     // This symbol is used to mark the construction of objects from C++ (with special logic).
     v8::Global<v8::Symbol> constructorSymbol_{};
 
+    v8::Global<v8::Value> objectPrototype_{};
+
     std::unordered_map<ManagedResource*, v8::Global<v8::Value>>            managedResources_;
     std::unordered_map<std::string, ClassMeta const*>                      registeredClasses_;
     std::unordered_map<ClassMeta const*, v8::Global<v8::FunctionTemplate>> classConstructors_;
@@ -122,6 +462,36 @@ private:
     std::unordered_map<std::type_index, ClassMeta const*> typeMapping_;
 
     std::unordered_map<std::string, EnumMeta const*> registeredEnums_;
+
+    std::unordered_map<ShapeMeta const*, ShapeCache> shapeCaches_;
+
+    std::vector<v8::Global<v8::String>> keyLiterals_; // indexed by Key<...>::id()
+
+    std::unordered_map<EnumMeta const*, EnumCache> enumCaches_;
+
+    std::deque<InlineMember> inlineMembers_; // callback data of inline value members (stable addresses)
+
+    std::deque<BulkProperties> bulkProperties_; // callback data of $assign / $snapshot (stable addresses)
+
+    // shared with in-flight async jobs, which post their completions to it
+    std::shared_ptr<TaskQueue> taskQueue_{std::make_shared<TaskQueue>()};
+
+    std::shared_ptr<WorkerPool>             workerPool_{nullptr};
+    std::unordered_map<uint64_t, AsyncCall> asyncCalls_;
+    uint64_t                                nextAsyncCall_{0};
+
+    std::function<std::chrono::steady_clock::time_point()> clock_{&std::chrono::steady_clock::now};
+
+    TimerWheel                         timerWheel_{};
+    std::unordered_map<TimerId, Timer> timers_;
+    std::deque<TimerId>                dueTimers_; // expired but not run yet, carried over between ticks
+    std::vector<TimerId>               expiredScratch_;
+    TimerId                            nextTimerId_{1};
+    TickStats                          tickStats_{};
+
+    v8::Global<v8::ObjectTemplate> indexedViewTemplate_{};
+    v8::Global<v8::ObjectTemplate> namedViewTemplate_{};
+    v8::Global<v8::FunctionTemplate> iteratorTemplate_{};
 };
 
 
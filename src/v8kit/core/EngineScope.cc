@@ -51,8 +51,22 @@ void EngineScope::ensureEngine(Engine* engine) {
 }
 
 
+ReentrantEngineScope::ReentrantEngineScope(Engine* engine) {
+    // ExitEngineScope does not leave the scope chain, so also check that the lock is still held
+    if (EngineScope::currentEngine() == engine && v8::Locker::IsLocked(engine->isolate())) {
+        handleScope_.emplace(engine->isolate());
+    } else {
+        scope_.emplace(engine);
+    }
+}
+
+
 ExitEngineScope::ExitEngineScope() : unlocker_(EngineScope::currentEngineChecked().isolate_) {}
 
+ChunkedHandleScope::ChunkedHandleScope(size_t chunk)
+: isolate_(EngineScope::currentEngineIsolateChecked()),
+  chunk_(chunk == 0 ? 1 : chunk) {}
+
 namespace internal {
 
 V8EscapeScope::V8EscapeScope() : handleScope_(EngineScope::currentEngineChecked().isolate_) {}
@@ -1,6 +1,8 @@
 #pragma once
 #include "v8kit/Macro.h"
 
+#include <optional>
+
 V8KIT_WARNING_GUARD_BEGIN
 #include <v8-context.h>
 #include <v8-isolate.h>
@@ -48,6 +50,22 @@ private:
     static thread_local EngineScope* gCurrentScope_;
 };
 
+/**
+ * @brief Enter `engine` like EngineScope, but when the current thread is already inside it (and holds the lock),
+ *        only open a HandleScope. For native -> script calls that are usually made from within the same engine.
+ */
+class ReentrantEngineScope final {
+    std::optional<EngineScope>     scope_;
+    std::optional<v8::HandleScope> handleScope_;
+
+public:
+    explicit ReentrantEngineScope(Engine* engine);
+    ~ReentrantEngineScope() = default;
+
+    V8KIT_DISABLE_COPY_MOVE(ReentrantEngineScope);
+    V8KIT_DISABLE_NEW();
+};
+
 class ExitEngineScope final {
     v8::Unlocker unlocker_;
 
@@ -59,6 +77,45 @@ public:
     V8KIT_DISABLE_NEW();
 };
 
+/**
+ * @brief Bounds the handles of a long loop: a HandleScope that is closed and reopened every `chunk` iterations
+ * @note Call step() at the end of every iteration, once its handles are no longer used. Results that must outlive
+ *       the loop belong in something created before it (e.g. an Array::newArray(n) filled with set()), or in C++.
+ * @note The first chunk runs in the enclosing scope, so handles a loop helper creates up front (Local<Array>::forEach
+ *       etc.) stay valid. At most two chunks of handles are alive at any time.
+ *
+ * @example
+ * auto array = Array::newArray(items.size());
+ * ChunkedHandleScope chunk;
+ * for (size_t i = 0; i < items.size(); ++i) {
+ *     array.set(i, toJs(items[i]));
+ *     chunk.step();
+ * }
+ */
+class ChunkedHandleScope final {
+    v8::Isolate*                   isolate_;
+    size_t const                   chunk_;
+    size_t                         count_{0};
+    std::optional<v8::HandleScope> scope_;
+
+public:
+    static constexpr size_t kDefaultChunk = 1024;
+
+    explicit ChunkedHandleScope(size_t chunk = kDefaultChunk);
+    ~ChunkedHandleScope() = default;
+
+    V8KIT_DISABLE_COPY_MOVE(ChunkedHandleScope);
+    V8KIT_DISABLE_NEW();
+
+    inline void step() {
+        if (++count_ == chunk_) {
+            count_ = 0;
+            scope_.reset();
+            scope_.emplace(isolate_);
+        }
+    }
+};
+
 
 namespace internal {
 
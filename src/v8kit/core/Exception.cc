@@ -29,6 +29,14 @@ Exception::Exception(v8::TryCatch const& tryCatch)
     ctx_->exception = v8::Global<v8::Value>(isolate, tryCatch.Exception());
 }
 
+Exception::Exception(Local<Value> const& exception)
+: std::exception(),
+  ctx_(std::make_shared<ExceptionContext>()) {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+
+    ctx_->exception = v8::Global<v8::Value>(isolate, exception.val);
+}
+
 Exception::Exception(std::string message, Type type)
 : std::exception(),
   ctx_(std::make_shared<ExceptionContext>()) {
@@ -65,6 +73,11 @@ std::string Exception::stacktrace() const noexcept {
     return "[ERROR: Could not get stacktrace]";
 }
 
+Local<Value> Exception::exception() const {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+    return Local<Value>{ctx_->exception.Get(isolate)};
+}
+
 void Exception::rethrowToRuntime() const {
     auto isolate = EngineScope::currentEngineIsolateChecked();
     isolate->ThrowException(ctx_->exception.Get(isolate));
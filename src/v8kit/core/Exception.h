@@ -1,4 +1,5 @@
 #pragma once
+#include "Fwd.h"
 #include "v8kit/Macro.h"
 #include <exception>
 #include <memory>
@@ -29,6 +30,11 @@ public:
     explicit Exception(v8::TryCatch const& tryCatch);
     explicit Exception(std::string message, Type type = Type::Error);
 
+    /**
+     * Wrap a thrown JavaScript value, e.g. the reason of a rejected promise
+     */
+    explicit Exception(Local<Value> const& exception);
+
     // The C++ standard requires exception classes to be reproducible
     Exception(Exception const&)                = default;
     Exception& operator=(Exception const&)     = default;
@@ -43,6 +49,11 @@ public:
 
     [[nodiscard]] std::string stacktrace() const noexcept;
 
+    /**
+     * @return the JavaScript value of this exception (an Error object for exceptions created in C++)
+     */
+    [[nodiscard]] Local<Value> exception() const;
+
     /**
      * Throw this exception to v8 (JavaScript).
      * Normally we don't need to call this method, the package library handles exceptions internally.
@@ -16,6 +16,7 @@ class EngineScope;
 class ExitEngineScope;
 
 enum class ValueKind : uint8_t;
+enum class PromiseState : uint8_t;
 
 class Value;
 class Null;
@@ -28,6 +29,10 @@ class Symbol;
 class Function;
 class Object;
 class Array;
+class Map;
+class Set;
+class Promise;
+class PromiseResolver;
 
 class Arguments;
 
@@ -54,7 +59,13 @@ class NativeInstance;
 using ConstructorCallback    = std::function<std::unique_ptr<NativeInstance>(Arguments const& args)>;
 using InstanceMethodCallback = std::function<Local<Value>(InstancePayload&, Arguments const& args)>;
 using InstanceGetterCallback = std::function<Local<Value>(InstancePayload&, Arguments const& args)>;
-using InstanceSetterCallback = std::function<void(InstancePayload&, Arguments const& args)>;
+using InstanceSetterCallback = std::function<void(InstancePayload&, Local<Value> const& value)>;
+
+
+class CancellationToken;
+class WorkerPool;
+// runs on a worker thread, returns the completion that produces the result on the engine thread
+using AsyncWork = std::function<std::function<Local<Value>()>(CancellationToken const& token)>;
 
 
 } // namespace v8kit
@@ -19,6 +19,7 @@ namespace v8kit {
 struct InstancePayload final {
 private:
     std::unique_ptr<NativeInstance> holder_;
+    NativeInstance*                 borrowed_{nullptr}; // inline values: a view of a stack copy, not owned
 
     // internal use only
     ClassMeta const* define_{nullptr};
@@ -29,7 +30,7 @@ private:
 
 
 public:
-    [[nodiscard]] inline NativeInstance* getHolder() { return holder_.get(); }
+    [[nodiscard]] inline NativeInstance* getHolder() { return holder_ ? holder_.get() : borrowed_; }
 
     [[nodiscard]] inline ClassMeta const* getDefine() const { return define_; }
 
@@ -44,6 +45,26 @@ public:
         if (holder_) {
             holder_.reset();
         }
+        borrowed_ = nullptr;
+    }
+
+    /**
+     * @brief 获取共享所有权 (std::shared_ptr 的控制块)
+     * @note 独占持有 (unique_ptr) 的实例会就地转为 shared_ptr 持有，对象地址不变
+     * @return nullptr 如果实例不归脚本所有 (如 ReturnValuePolicy::kReference)
+     */
+    inline std::shared_ptr<void> shareOwnership() {
+        if (!holder_) {
+            return nullptr;
+        }
+        if (auto shared = holder_->get_shared_ptr()) {
+            return shared;
+        }
+        if (auto upgraded = holder_->to_shared()) {
+            holder_ = std::move(upgraded);
+            return holder_->get_shared_ptr();
+        }
+        return nullptr;
     }
 
     template <typename T>
@@ -51,6 +72,9 @@ public:
         if (holder_) {
             return holder_->unwrap<T>();
         }
+        if (borrowed_) {
+            return borrowed_->unwrap<T>();
+        }
         return nullptr;
     }
 
@@ -73,6 +97,15 @@ public:
 
     ~InstancePayload() = default;
 
+private:
+    // 内联值类型: 借用栈上副本 (仅在一次成员调用期间有效)
+    explicit InstancePayload(NativeInstance& borrowed, ClassMeta const* define, Engine const* engine)
+    : borrowed_(&borrowed),
+      define_(define),
+      engine_(engine) {}
+
+public:
+
     template <typename... Args>
         requires std::constructible_from<InstancePayload, Args...>
     static inline std::unique_ptr<InstancePayload> make(Args&&... args) {
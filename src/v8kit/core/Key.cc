@@ -0,0 +1,12 @@
+#include "Key.h"
+
+#include <atomic>
+
+namespace v8kit::internal {
+
+size_t allocateKeyId() {
+    static std::atomic<size_t> next{0};
+    return next.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace v8kit::internal
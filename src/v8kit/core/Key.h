@@ -0,0 +1,69 @@
+#pragma once
+#include "Engine.h"
+#include "EngineScope.h"
+#include "Reference.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+
+namespace v8kit {
+
+/**
+ * @brief String literal usable as a template argument (Key<"name">)
+ */
+template <size_t N>
+struct FixedString {
+    char data_[N]{};
+
+    constexpr FixedString(char const (&str)[N]) { std::copy_n(str, N, data_); } // NOLINT: implicit by design
+
+    [[nodiscard]] constexpr std::string_view view() const { return {data_, N - 1}; }
+};
+
+namespace internal {
+
+/**
+ * @return a process-wide unique, dense id (one per distinct Key<...> type, assigned on first use)
+ */
+size_t allocateKeyId();
+
+} // namespace internal
+
+/**
+ * @brief Property name known at compile time, resolved once per engine to a cached internalized string
+ * @note Converts to Local<String>, so it is accepted wherever a key is: `obj.get("name"_key)`.
+ *       After the first use in an engine, a lookup is an index into a per-engine table (no UTF-8 decoding,
+ *       no allocation, no hashing in V8's string table).
+ *
+ * @example
+ * using namespace v8kit::literals;
+ * auto name = obj.get("name"_key);
+ * obj.set(Key<"id">{}, Number::newNumber(1));
+ */
+template <FixedString S>
+struct Key {
+    [[nodiscard]] static constexpr std::string_view view() { return S.view(); }
+
+    [[nodiscard]] static size_t id() {
+        static size_t const id = internal::allocateKeyId();
+        return id;
+    }
+
+    [[nodiscard]] Local<String> get() const { return EngineScope::currentEngineChecked().keyLiteral(id(), view()); }
+
+    operator Local<String>() const { return get(); } // NOLINT: implicit by design
+
+    operator Local<Value>() const { return get().asValue(); } // NOLINT: implicit by design
+};
+
+inline namespace literals {
+
+template <FixedString S>
+[[nodiscard]] constexpr Key<S> operator""_key() {
+    return {};
+}
+
+} // namespace literals
+
+} // namespace v8kit
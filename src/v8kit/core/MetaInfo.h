@@ -3,9 +3,21 @@
 
 #include <string>
 #include <typeindex>
+#include <vector>
 
 namespace v8kit {
 
+/**
+ * @brief Fixed layout of a plain data object (ordered field names)
+ * @note Objects created through Engine::newObject(ShapeMeta const&, ...) share one hidden class.
+ * @note Engine caches per-shape data by address, so a ShapeMeta must outlive the engines using it.
+ */
+struct ShapeMeta {
+    std::vector<std::string> const fields_;
+
+    explicit ShapeMeta(std::vector<std::string> fields) : fields_(std::move(fields)) {}
+};
+
 struct StaticMemberMeta {
     struct Property {
         std::string const    name_;
@@ -58,9 +70,14 @@ struct InstanceMemberMeta {
 
     ConstructorCallback const   constructor_;
     std::vector<Property> const property_;
+    ShapeMeta const             propertyShape_; // property names, layout of the $snapshot() object
     std::vector<Method> const   methods_;
     size_t const                classSize_{0}; // sizeof(C) for instance class
 
+    // inline value class: bytes of C stored in the wrapper itself (0: heap instance, see Engine::newInlineValue)
+    static constexpr size_t kMaxInlineSize = 32;
+    size_t const            inlineSize_{0};
+
     // script helper
     using InstanceEqualsCallback = bool (*)(void* lhs, void* rhs);
     InstanceEqualsCallback const equals_{nullptr};
@@ -78,15 +95,28 @@ struct InstanceMemberMeta {
         size_t                 classSize,
         InstanceEqualsCallback equals,
         CopyCloneCtor          copyCloneCtor = nullptr,
-        MoveCloneCtor          moveCloneCtor = nullptr
+        MoveCloneCtor          moveCloneCtor = nullptr,
+        size_t                 inlineSize    = 0
     )
     : constructor_(std::move(constructor)),
       property_(std::move(property)),
+      propertyShape_(propertyNames(property_)),
       methods_(std::move(functions)),
       classSize_(classSize),
+      inlineSize_(inlineSize),
       equals_(equals),
       copyCloneCtor_(copyCloneCtor),
       moveCloneCtor_(moveCloneCtor) {}
+
+private:
+    static std::vector<std::string> propertyNames(std::vector<Property> const& property) {
+        std::vector<std::string> names;
+        names.reserve(property.size());
+        for (auto const& prop : property) {
+            names.push_back(prop.name_);
+        }
+        return names;
+    }
 };
 
 struct ClassMeta {
@@ -163,10 +193,12 @@ public:
 
     std::string const        name_;
     std::vector<Entry> const entries_;
+    bool const               stringValues_{false}; // entries are exposed (and converted) as their name strings
 
-    explicit EnumMeta(std::string name, std::vector<Entry> entries)
+    explicit EnumMeta(std::string name, std::vector<Entry> entries, bool stringValues = false)
     : name_(std::move(name)),
-      entries_(std::move(entries)) {}
+      entries_(std::move(entries)),
+      stringValues_(stringValues) {}
 };
 
 
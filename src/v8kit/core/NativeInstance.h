@@ -29,11 +29,25 @@ public:
 
     virtual bool is_owned() const = 0;
 
+    /**
+     * @brief Re-hold an owned instance through a std::shared_ptr (the object itself does not move)
+     * @return the replacement holder, nullptr if this holder cannot share ownership
+     */
+    virtual std::unique_ptr<NativeInstance> to_shared() { return nullptr; }
+
+    /**
+     * @brief Called before a mutable pointer is handed out (copy-on-write holders detach here)
+     */
+    virtual void ensure_writable() const {}
+
     template <typename T>
     T* unwrap() const {
         if (is_const() && !std::is_const_v<T>) {
             throw Exception("Cannot unwrap const instance to mutable pointer");
         }
+        if constexpr (!std::is_const_v<T>) {
+            ensure_writable();
+        }
         void* raw = cast(std::type_index(typeid(std::remove_cv_t<T>)));
         return static_cast<T*>(raw);
     }
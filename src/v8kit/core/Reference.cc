@@ -13,6 +13,7 @@ V8KIT_WARNING_GUARD_BEGIN
 #include <v8-exception.h>
 #include <v8-local-handle.h>
 #include <v8-primitive.h>
+#include <v8-promise.h>
 #include <v8-value.h>
 V8KIT_WARNING_GUARD_END
 
@@ -32,6 +33,9 @@ bool Local<Value>::isSymbol() const { return !val.IsEmpty() && !isNullOrUndefine
 bool Local<Value>::isObject() const { return !val.IsEmpty() && !isNullOrUndefined() && val->IsObject(); }
 bool Local<Value>::isArray() const { return !val.IsEmpty() && !isNullOrUndefined() && val->IsArray(); }
 bool Local<Value>::isFunction() const { return !val.IsEmpty() && !isNullOrUndefined() && val->IsFunction(); }
+bool Local<Value>::isMap() const { return !val.IsEmpty() && !isNullOrUndefined() && val->IsMap(); }
+bool Local<Value>::isSet() const { return !val.IsEmpty() && !isNullOrUndefined() && val->IsSet(); }
+bool Local<Value>::isPromise() const { return !val.IsEmpty() && !isNullOrUndefined() && val->IsPromise(); }
 
 Local<Value> Local<Value>::asValue() const { return *this; }
 Local<Null>  Local<Value>::asNull() const {
@@ -74,6 +78,18 @@ Local<Function> Local<Value>::asFunction() const {
     if (isFunction()) return Local<Function>{val.As<v8::Function>()};
     throw Exception("cannot convert to Function");
 }
+Local<Map> Local<Value>::asMap() const {
+    if (isMap()) return Local<Map>{val.As<v8::Map>()};
+    throw Exception("cannot convert to Map");
+}
+Local<Set> Local<Value>::asSet() const {
+    if (isSet()) return Local<Set>{val.As<v8::Set>()};
+    throw Exception("cannot convert to Set");
+}
+Local<Promise> Local<Value>::asPromise() const {
+    if (isPromise()) return Local<Promise>{val.As<v8::Promise>()};
+    throw Exception("cannot convert to Promise");
+}
 
 void Local<Value>::clear() { val.Clear(); }
 
@@ -85,9 +101,13 @@ ValueKind Local<Value>::kind() const {
     if (isBigInt()) return ValueKind::kBigInt;
     if (isString()) return ValueKind::kString;
     if (isSymbol()) return ValueKind::kSymbol;
-    if (isObject()) return ValueKind::kObject;
+    // arrays, functions and collections are objects too, so they must be checked first
     if (isArray()) return ValueKind::kArray;
     if (isFunction()) return ValueKind::kFunction;
+    if (isMap()) return ValueKind::kMap;
+    if (isSet()) return ValueKind::kSet;
+    if (isPromise()) return ValueKind::kPromise;
+    if (isObject()) return ValueKind::kObject;
     [[unlikely]] throw std::logic_error("Unknown type, did you forget to add if branch?");
 }
 
@@ -172,6 +192,21 @@ std::string Local<String>::getValue() const {
     }
     return std::string{*utf8, static_cast<size_t>(utf8.length())};
 }
+size_t Local<String>::utf8Length() const {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+    return static_cast<size_t>(val->Utf8Length(isolate));
+}
+size_t Local<String>::writeUtf8(char* buffer, size_t capacity) const {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+    int  written = val->WriteUtf8(
+        isolate,
+        buffer,
+        static_cast<int>(capacity),
+        nullptr,
+        v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8
+    );
+    return static_cast<size_t>(written);
+}
 
 
 IMPL_SPECIALIZATION_LOCAL(Symbol);
@@ -217,6 +252,41 @@ void Local<Object>::remove(Local<String> const& key) {
     Exception::rethrow(vtry);
 }
 
+void Local<Object>::setMany(std::span<const Local<String>> keys, std::span<const Local<Value>> values) {
+    if (keys.size() != values.size()) {
+        throw Exception{"Local<Object>::setMany: keys and values must have the same size", Exception::Type::RangeError};
+    }
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (val->Set(ctx, keys[i].val, values[i].val).IsNothing()) {
+            Exception::rethrow(vtry);
+        }
+    }
+}
+void Local<Object>::setMany(std::span<const std::pair<Local<String>, Local<Value>>> properties) {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    for (auto const& [key, value] : properties) {
+        if (val->Set(ctx, key.val, value.val).IsNothing()) {
+            Exception::rethrow(vtry);
+        }
+    }
+}
+
+void Local<Object>::getMany(std::span<const Local<String>> keys, std::span<Local<Value>> out) const {
+    if (out.size() < keys.size()) {
+        throw Exception{"Local<Object>::getMany: output span is smaller than keys", Exception::Type::RangeError};
+    }
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto maybe = val->Get(ctx, keys[i].val);
+        Exception::rethrow(vtry);
+        out[i] = Local<Value>{maybe.ToLocalChecked()};
+    }
+}
+
 std::vector<Local<String>> Local<Object>::getOwnPropertyNames() const {
     auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
     v8::TryCatch vtry{isolate};
@@ -228,14 +298,13 @@ std::vector<Local<String>> Local<Object>::getOwnPropertyNames() const {
     std::vector<Local<String>> result;
     result.reserve(array->Length());
 
+    // the handles are returned to the caller, so they are created right in its scope
     for (uint32_t i = 0; i < array->Length(); ++i) {
-        internal::V8EscapeScope scope{isolate};
-
         auto maybeVal = array->Get(ctx, i);
         Exception::rethrow(vtry);
         auto value = maybeVal.ToLocalChecked();
         if (value->IsString()) {
-            result.push_back(Local<String>{scope.escape(value.As<v8::String>())});
+            result.push_back(Local<String>{value.As<v8::String>()});
         }
     }
     return result;
@@ -286,6 +355,29 @@ bool Local<Object>::defineProperty(Local<String> const& key, PropertyDescriptor&
     return maybe.ToChecked();
 }
 
+bool Local<Object>::defineOwnProperties(
+    std::span<const Local<String>> keys,
+    std::span<const Local<Value>>  values,
+    PropertyAttribute              attrs
+) const {
+    if (keys.size() != values.size()) {
+        throw Exception{
+            "Local<Object>::defineOwnProperties: keys and values must have the same size",
+            Exception::Type::RangeError
+        };
+    }
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+
+    bool all = true;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto maybe = val->DefineOwnProperty(ctx, keys[i].val, values[i].val, attrs);
+        Exception::rethrow(vtry);
+        all = maybe.ToChecked() && all;
+    }
+    return all;
+}
+
 
 IMPL_SPECIALIZATION_LOCAL(Array);
 IMPL_SPECALIZATION_AS_VALUE(Array);
@@ -328,6 +420,141 @@ void Local<Array>::clear() {
 Local<Value> Local<Array>::operator[](size_t index) const { return get(index); }
 
 
+IMPL_SPECIALIZATION_LOCAL(Map);
+IMPL_SPECALIZATION_AS_VALUE(Map);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(Map);
+size_t Local<Map>::size() const { return val->Size(); }
+
+bool Local<Map>::has(Local<Value> const& key) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Has(ctx, key.val);
+    Exception::rethrow(vtry);
+    return maybe.ToChecked();
+}
+
+Local<Value> Local<Map>::get(Local<Value> const& key) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Get(ctx, key.val);
+    Exception::rethrow(vtry);
+    return Local<Value>{maybe.ToLocalChecked()};
+}
+
+void Local<Map>::set(Local<Value> const& key, Local<Value> const& value) {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    (void)val->Set(ctx, key.val, value.val).IsEmpty(); // empty on exception, reported below
+    Exception::rethrow(vtry);
+}
+
+bool Local<Map>::remove(Local<Value> const& key) {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Delete(ctx, key.val);
+    Exception::rethrow(vtry);
+    return maybe.ToChecked();
+}
+
+void Local<Map>::clear() { val->Clear(); }
+
+Local<Array> Local<Map>::toArray() const { return Local<Array>{val->AsArray()}; }
+
+
+IMPL_SPECIALIZATION_LOCAL(Set);
+IMPL_SPECALIZATION_AS_VALUE(Set);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(Set);
+size_t Local<Set>::size() const { return val->Size(); }
+
+bool Local<Set>::has(Local<Value> const& value) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Has(ctx, value.val);
+    Exception::rethrow(vtry);
+    return maybe.ToChecked();
+}
+
+void Local<Set>::add(Local<Value> const& value) {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    (void)val->Add(ctx, value.val).IsEmpty(); // empty on exception, reported below
+    Exception::rethrow(vtry);
+}
+
+bool Local<Set>::remove(Local<Value> const& value) {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Delete(ctx, value.val);
+    Exception::rethrow(vtry);
+    return maybe.ToChecked();
+}
+
+void Local<Set>::clear() { val->Clear(); }
+
+Local<Array> Local<Set>::toArray() const { return Local<Array>{val->AsArray()}; }
+
+
+IMPL_SPECIALIZATION_LOCAL(Promise);
+IMPL_SPECALIZATION_AS_VALUE(Promise);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(Promise);
+PromiseState Local<Promise>::state() const {
+    switch (val->State()) {
+    case v8::Promise::kPending:
+        return PromiseState::kPending;
+    case v8::Promise::kFulfilled:
+        return PromiseState::kFulfilled;
+    case v8::Promise::kRejected:
+        return PromiseState::kRejected;
+    }
+    [[unlikely]] throw std::logic_error("Unknown promise state");
+}
+
+Local<Value> Local<Promise>::result() const {
+    if (val->State() == v8::Promise::kPending) {
+        throw std::logic_error("Local<Promise>::result called on a pending promise");
+    }
+    return Local<Value>{val->Result()};
+}
+
+Local<Promise> Local<Promise>::then(Local<Function> const& onFulfilled) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Then(ctx, onFulfilled.val);
+    Exception::rethrow(vtry);
+    return Local<Promise>{maybe.ToLocalChecked()};
+}
+
+Local<Promise> Local<Promise>::then(Local<Function> const& onFulfilled, Local<Function> const& onRejected) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = val->Then(ctx, onFulfilled.val, onRejected.val);
+    Exception::rethrow(vtry);
+    return Local<Promise>{maybe.ToLocalChecked()};
+}
+
+void Local<Promise>::markAsHandled() const { val->MarkAsHandled(); }
+
+
+IMPL_SPECIALIZATION_LOCAL(PromiseResolver);
+IMPL_SPECALIZATION_AS_VALUE(PromiseResolver);
+IMPL_SPECALIZATION_V8_LOCAL_TYPE(PromiseResolver);
+Local<Promise> Local<PromiseResolver>::getPromise() const { return Local<Promise>{val->GetPromise()}; }
+
+void Local<PromiseResolver>::resolve(Local<Value> const& value) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    (void)val->Resolve(ctx, value.val).IsNothing(); // nothing on exception, reported below
+    Exception::rethrow(vtry);
+}
+
+void Local<PromiseResolver>::reject(Local<Value> const& reason) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    (void)val->Reject(ctx, reason.val).IsNothing(); // nothing on exception, reported below
+    Exception::rethrow(vtry);
+}
+
+
 IMPL_SPECIALIZATION_LOCAL(Function);
 IMPL_SPECALIZATION_AS_VALUE(Function);
 IMPL_SPECALIZATION_V8_LOCAL_TYPE(Function);
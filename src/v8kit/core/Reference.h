@@ -4,14 +4,19 @@
 #include "v8kit/Macro.h"
 
 #include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 V8KIT_WARNING_GUARD_BEGIN
+#include <v8-container.h>
 #include <v8-function.h>
 #include <v8-local-handle.h>
 #include <v8-primitive.h>
+#include <v8-promise.h>
 V8KIT_WARNING_GUARD_END
 
 
@@ -82,6 +87,9 @@ public:
     [[nodiscard]] bool isObject() const;
     [[nodiscard]] bool isArray() const;
     [[nodiscard]] bool isFunction() const;
+    [[nodiscard]] bool isMap() const;
+    [[nodiscard]] bool isSet() const;
+    [[nodiscard]] bool isPromise() const;
 
     [[nodiscard]] Local<Value>     asValue() const;
     [[nodiscard]] Local<Null>      asNull() const;
@@ -94,6 +102,9 @@ public:
     [[nodiscard]] Local<Object>    asObject() const;
     [[nodiscard]] Local<Array>     asArray() const;
     [[nodiscard]] Local<Function>  asFunction() const;
+    [[nodiscard]] Local<Map>       asMap() const;
+    [[nodiscard]] Local<Set>       asSet() const;
+    [[nodiscard]] Local<Promise>   asPromise() const;
 
     /**
      * @tparam T must be the type of as described above
@@ -169,6 +180,14 @@ class Local<String> {
 public:
     [[nodiscard]] int         length() const;
     [[nodiscard]] std::string getValue() const;
+
+    [[nodiscard]] size_t utf8Length() const; // UTF-8 byte length, without null terminator
+
+    /**
+     * Write the UTF-8 encoding into a caller-owned buffer (no null terminator).
+     * @return number of bytes written (at most capacity)
+     */
+    size_t writeUtf8(char* buffer, size_t capacity) const;
 };
 
 template <>
@@ -198,10 +217,33 @@ public:
 
     void remove(Local<String> const& key);
 
+    /**
+     * Batched set: one context lookup and one TryCatch for all properties (stops at the first one that throws).
+     * @note to build a new object, Object::newObject(keys, values) creates it with all properties in one step
+     */
+    void setMany(std::span<const Local<String>> keys, std::span<const Local<Value>> values);
+    void setMany(std::span<const std::pair<Local<String>, Local<Value>>> properties);
+
+    /**
+     * Batched get, missing properties read as undefined.
+     * @param out must hold at least keys.size() elements, otherwise a RangeError is thrown (as by setMany)
+     */
+    void getMany(std::span<const Local<String>> keys, std::span<Local<Value>> out) const;
+
     [[nodiscard]] std::vector<Local<String>> getOwnPropertyNames() const;
 
     [[nodiscard]] std::vector<std::string> getOwnPropertyNamesAsString() const;
 
+    /**
+     * Visit every own enumerable string-keyed property (index keys included, as strings) like Object.entries,
+     * without intermediate vectors: one TryCatch for the walk, one handle scope per batch of properties.
+     * @param fn `void(std::string_view key, Local<Value> const& value)` (UTF-8, short keys need no allocation)
+     *           or `void(Local<String> const& key, Local<Value> const& value)`, either may return bool (false stops)
+     * @note the key view and the handles are only valid during the call, convert (or Global) what you keep
+     */
+    template <typename Fn>
+    void forEachOwnProperty(Fn&& fn) const;
+
     [[nodiscard]] bool instanceof(Local<Value> const& type) const;
 
     [[nodiscard]] bool defineOwnProperty(
@@ -211,6 +253,16 @@ public:
     ) const;
 
     [[nodiscard]] bool defineProperty(Local<String> const& key, PropertyDescriptor& desc) const;
+
+    /**
+     * Batched defineOwnProperty, every property gets the same attributes.
+     * @return false if any property could not be defined
+     */
+    [[nodiscard]] bool defineOwnProperties(
+        std::span<const Local<String>> keys,
+        std::span<const Local<Value>>  values,
+        PropertyAttribute              attrs = PropertyAttribute::None
+    ) const;
 };
 
 template <>
@@ -231,6 +283,117 @@ public:
     void clear();
 
     Local<Value> operator[](size_t index) const;
+
+    /**
+     * Visit every element, sharing one context lookup and one TryCatch for the whole array.
+     * @param fn `void(size_t index, Local<Value> const& element)`, or returning bool (false stops iterating)
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const;
+
+    /**
+     * Fast path for numeric arrays: reads elements through v8::Array::Iterate without creating handles.
+     * @param out must hold at least length() elements
+     * @return false if any element is not a number (out is then partially written)
+     */
+    template <typename T>
+        requires concepts::NumberLike<T>
+    [[nodiscard]] bool readNumbers(std::span<T> out) const;
+};
+
+template <>
+class Local<Map> {
+    SPECIALIZATION_LOCAL(Map);
+    SPECALIZATION_AS_VALUE(Map);
+    SPECALIZATION_V8_LOCAL_TYPE(Map);
+
+public:
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] bool has(Local<Value> const& key) const;
+
+    [[nodiscard]] Local<Value> get(Local<Value> const& key) const; // undefined if not found
+
+    void set(Local<Value> const& key, Local<Value> const& value);
+
+    bool remove(Local<Value> const& key);
+
+    void clear();
+
+    /**
+     * @return flat snapshot of the entries: [key0, value0, key1, value1, ...] (v8::Map::AsArray)
+     */
+    [[nodiscard]] Local<Array> toArray() const;
+
+    /**
+     * Visit every entry through a single toArray() snapshot.
+     * @param fn `void(Local<Value> const& key, Local<Value> const& value)`
+     */
+    template <typename Fn>
+    void forEach(Fn&& fn) const;
+};
+
+template <>
+class Local<Set> {
+    SPECIALIZATION_LOCAL(Set);
+    SPECALIZATION_AS_VALUE(Set);
+    SPECALIZATION_V8_LOCAL_TYPE(Set);
+
+public:
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] bool has(Local<Value> const& value) const;
+
+    void add(Local<Value> const& value);
+
+    bool remove(Local<Value> const& value);
+
+    void clear();
+
+    [[nodiscard]] Local<Array> toArray() const; // v8::Set::AsArray
+};
+
+template <>
+class Local<Promise> {
+    SPECIALIZATION_LOCAL(Promise);
+    SPECALIZATION_AS_VALUE(Promise);
+    SPECALIZATION_V8_LOCAL_TYPE(Promise);
+
+public:
+    [[nodiscard]] PromiseState state() const;
+
+    /**
+     * @return the fulfilled value or the rejection reason
+     * @throws std::logic_error while the promise is pending
+     */
+    [[nodiscard]] Local<Value> result() const;
+
+    /**
+     * JavaScript: promise.then(onFulfilled, onRejected), the reactions run at the next microtask checkpoint
+     */
+    Local<Promise> then(Local<Function> const& onFulfilled) const;
+    Local<Promise> then(Local<Function> const& onFulfilled, Local<Function> const& onRejected) const;
+
+    /**
+     * Mark the promise as handled, a rejection is then not reported as unhandled
+     */
+    void markAsHandled() const;
+};
+
+template <>
+class Local<PromiseResolver> {
+    SPECIALIZATION_LOCAL(PromiseResolver);
+    SPECALIZATION_AS_VALUE(PromiseResolver);
+    SPECALIZATION_V8_LOCAL_TYPE(PromiseResolver);
+
+public:
+    [[nodiscard]] Local<Promise> getPromise() const;
+
+    /**
+     * Settle the promise, calls after the first one have no effect (resolving with a thenable adopts its state)
+     */
+    void resolve(Local<Value> const& value) const;
+    void reject(Local<Value> const& reason) const;
 };
 
 template <>
@@ -2,9 +2,20 @@
 #include "Engine.h"
 #include "EngineScope.h"
 #include "Reference.h" // NOLINT
+#include "Exception.h"
 #include "ValueHelper.h"
 
+#include <algorithm>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+V8KIT_WARNING_GUARD_BEGIN
+#include <v8-container.h>
+#include <v8-exception.h>
+#include <v8-object.h>
+V8KIT_WARNING_GUARD_END
 
 namespace v8kit {
 
@@ -33,11 +44,147 @@ Local<T> Local<Value>::as() const {
         return asObject();
     } else if constexpr (std::is_same_v<T, Array>) {
         return asArray();
+    } else if constexpr (std::is_same_v<T, Map>) {
+        return asMap();
+    } else if constexpr (std::is_same_v<T, Set>) {
+        return asSet();
+    } else if constexpr (std::is_same_v<T, Promise>) {
+        return asPromise();
     }
     [[unlikely]] throw std::logic_error("Unable to convert Local<Value> to T, forgot to add if branch?");
 }
 
 
+// Local<Object>
+template <typename Fn>
+void Local<Object>::forEachOwnProperty(Fn&& fn) const {
+    constexpr uint32_t kBatch    = 64; // properties per handle scope
+    constexpr bool     kViewKeys = std::is_invocable_v<Fn&, std::string_view, Local<Value> const&>;
+
+    using KeyType           = std::conditional_t<kViewKeys, std::string_view, Local<String> const&>;
+    constexpr bool kCanStop = std::is_same_v<std::invoke_result_t<Fn&, KeyType, Local<Value> const&>, bool>;
+
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+
+    auto maybeKeys = val->GetOwnPropertyNames(
+        ctx,
+        static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS),
+        v8::KeyConversionMode::kConvertToString
+    );
+    Exception::rethrow(vtry);
+    auto keys = maybeKeys.ToLocalChecked();
+
+    char        small[128]; // UTF-8 of short keys
+    std::string large;
+
+    uint32_t length = keys->Length();
+    for (uint32_t begin = 0; begin < length; begin += kBatch) {
+        v8::HandleScope scope{isolate};
+        for (uint32_t index = begin, end = std::min(begin + kBatch, length); index < end; ++index) {
+            auto maybeKey = keys->Get(ctx, index);
+            Exception::rethrow(vtry);
+            Local<String> key{maybeKey.ToLocalChecked().template As<v8::String>()};
+
+            auto maybeValue = val->Get(ctx, key.val);
+            Exception::rethrow(vtry);
+            Local<Value> value{maybeValue.ToLocalChecked()};
+
+            auto invoke = [&](KeyType k) -> bool {
+                if constexpr (kCanStop) {
+                    return fn(k, value);
+                } else {
+                    fn(k, value);
+                    return true;
+                }
+            };
+            bool proceed;
+            if constexpr (kViewKeys) {
+                auto  size   = key.utf8Length();
+                char* buffer = small;
+                if (size > sizeof(small)) {
+                    large.resize(size);
+                    buffer = large.data();
+                }
+                proceed = invoke(std::string_view{buffer, key.writeUtf8(buffer, size)});
+            } else {
+                proceed = invoke(key);
+            }
+            if (!proceed) {
+                return;
+            }
+        }
+    }
+}
+
+
+// Local<Array>
+template <typename Fn>
+void Local<Array>::forEach(Fn&& fn) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+
+    uint32_t length = val->Length();
+    for (uint32_t index = 0; index < length; ++index) {
+        auto maybe = val->Get(ctx, index);
+        Exception::rethrow(vtry);
+
+        Local<Value> element{maybe.ToLocalChecked()};
+        if constexpr (std::is_same_v<std::invoke_result_t<Fn&, size_t, Local<Value> const&>, bool>) {
+            if (!fn(static_cast<size_t>(index), element)) {
+                break;
+            }
+        } else {
+            fn(static_cast<size_t>(index), element);
+        }
+    }
+}
+
+// Local<Map>
+template <typename Fn>
+void Local<Map>::forEach(Fn&& fn) const {
+    Local<Value> key;
+    toArray().forEach([&](size_t index, Local<Value> const& element) {
+        if (index % 2 == 0) {
+            key = element;
+        } else {
+            fn(key, element);
+        }
+    });
+}
+
+template <typename T>
+    requires concepts::NumberLike<T>
+bool Local<Array>::readNumbers(std::span<T> out) const {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    if (out.size() < val->Length()) {
+        throw std::out_of_range("Local<Array>::readNumbers: output span is smaller than the array");
+    }
+    struct State {
+        std::span<T> out;
+        bool         allNumbers{true};
+    } state{out};
+
+    // The callback must not allocate or call back into V8, so it only reads raw number values.
+    v8::TryCatch vtry{isolate};
+    auto result = val->Iterate(
+        ctx,
+        [](uint32_t index, v8::Local<v8::Value> element, void* data) -> v8::Array::CallbackResult {
+            auto& st = *static_cast<State*>(data);
+            if (!element->IsNumber()) {
+                st.allNumbers = false;
+                return v8::Array::CallbackResult::kBreak;
+            }
+            st.out[index] = static_cast<T>(element.As<v8::Number>()->Value());
+            return v8::Array::CallbackResult::kContinue;
+        },
+        &state
+    );
+    Exception::rethrow(vtry);
+    return result.IsJust() && state.allNumbers;
+}
+
+
 // Global<T>
 template <typename T>
 Global<T>::Global() noexcept = default;
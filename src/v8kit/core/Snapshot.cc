@@ -0,0 +1,689 @@
+#include "Snapshot.h"
+
+#include "Engine.h"
+#include "EngineScope.h"
+#include "Exception.h"
+#include "Reference.h"
+#include "ValueHelper.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <unordered_map>
+
+V8KIT_WARNING_GUARD_BEGIN
+#include <v8-container.h>
+#include <v8-exception.h>
+#include <v8-local-handle.h>
+#include <v8-object.h>
+#include <v8-primitive.h>
+#include <v8-value.h>
+V8KIT_WARNING_GUARD_END
+
+namespace v8kit {
+
+
+// Node
+Snapshot::Kind Snapshot::Node::kind() const { return owner_->entry(id_).kind; }
+
+bool Snapshot::Node::asBoolean() const {
+    auto& e = owner_->entry(id_);
+    if (e.kind != Kind::Boolean) {
+        throw Exception{"Snapshot::Node: not a boolean", Exception::Type::TypeError};
+    }
+    return e.boolean;
+}
+double Snapshot::Node::asNumber() const {
+    auto& e = owner_->entry(id_);
+    if (e.kind != Kind::Number) {
+        throw Exception{"Snapshot::Node: not a number", Exception::Type::TypeError};
+    }
+    return e.number;
+}
+std::string_view Snapshot::Node::asString() const {
+    auto& e = owner_->entry(id_);
+    if (e.kind != Kind::String) {
+        throw Exception{"Snapshot::Node: not a string", Exception::Type::TypeError};
+    }
+    return owner_->string(e.string);
+}
+
+size_t Snapshot::Node::size() const {
+    auto& e = owner_->entry(id_);
+    return e.kind == Kind::Array || e.kind == Kind::Object ? e.size : 0;
+}
+
+Snapshot::Node Snapshot::Node::operator[](size_t index) const {
+    if (index >= size()) {
+        throw Exception{"Snapshot::Node: index out of range", Exception::Type::RangeError};
+    }
+    return Node{owner_, owner_->slots_[owner_->entry(id_).first + index].node};
+}
+
+std::string_view Snapshot::Node::keyAt(size_t index) const {
+    if (kind() != Kind::Object) {
+        throw Exception{"Snapshot::Node: not an object", Exception::Type::TypeError};
+    }
+    if (index >= size()) {
+        throw Exception{"Snapshot::Node: index out of range", Exception::Type::RangeError};
+    }
+    return owner_->string(owner_->slots_[owner_->entry(id_).first + index].key);
+}
+
+std::optional<Snapshot::Node> Snapshot::Node::find(std::string_view key) const {
+    auto& e = owner_->entry(id_);
+    if (e.kind != Kind::Object) {
+        return std::nullopt;
+    }
+    for (uint32_t i = 0; i < e.size; ++i) {
+        auto& slot = owner_->slots_[e.first + i];
+        if (owner_->string(slot.key) == key) {
+            return Node{owner_, slot.node};
+        }
+    }
+    return std::nullopt;
+}
+
+
+// Snapshot
+Snapshot::Snapshot() {
+    Entry null{};
+    null.kind = Kind::Null;
+    nodes_.push_back(null);
+}
+
+std::string_view Snapshot::string(uint32_t index) const {
+    auto& ref = strings_[index];
+    return std::string_view{pool_}.substr(ref.offset, ref.length);
+}
+
+
+// Builder
+uint32_t Snapshot::Builder::intern(std::string_view value) {
+    if (auto iter = interned_.find(value); iter != interned_.end()) {
+        return iter->second;
+    }
+    auto& snap = snapshot_;
+    if (snap.pool_.size() + value.size() > std::numeric_limits<uint32_t>::max()) {
+        throw Exception{"Snapshot: string pool exceeds 4 GiB", Exception::Type::RangeError};
+    }
+    auto index = static_cast<uint32_t>(snap.strings_.size());
+    snap.strings_.push_back({static_cast<uint32_t>(snap.pool_.size()), static_cast<uint32_t>(value.size())});
+    snap.pool_.append(value);
+    interned_.emplace(value, index);
+    return index;
+}
+
+Snapshot::NodeId Snapshot::Builder::push(Entry entry) {
+    snapshot_.nodes_.push_back(entry);
+    return static_cast<NodeId>(snapshot_.nodes_.size() - 1);
+}
+
+Snapshot::NodeId Snapshot::Builder::container(Kind kind, std::span<const Slot> slots) {
+    Entry e{};
+    e.kind  = kind;
+    e.size  = static_cast<uint32_t>(slots.size());
+    e.first = static_cast<uint32_t>(snapshot_.slots_.size());
+    snapshot_.slots_.insert(snapshot_.slots_.end(), slots.begin(), slots.end());
+    return push(e);
+}
+
+Snapshot::NodeId Snapshot::Builder::null() {
+    Entry e{};
+    e.kind = Kind::Null;
+    return push(e);
+}
+Snapshot::NodeId Snapshot::Builder::boolean(bool value) {
+    Entry e{};
+    e.kind    = Kind::Boolean;
+    e.boolean = value;
+    return push(e);
+}
+Snapshot::NodeId Snapshot::Builder::number(double value) {
+    Entry e{};
+    e.kind   = Kind::Number;
+    e.number = value;
+    return push(e);
+}
+Snapshot::NodeId Snapshot::Builder::string(std::string_view value) {
+    Entry e{};
+    e.kind   = Kind::String;
+    e.string = intern(value);
+    return push(e);
+}
+
+Snapshot::NodeId Snapshot::Builder::array(std::span<const NodeId> elements) {
+    auto const first = static_cast<uint32_t>(snapshot_.slots_.size());
+    for (auto id : elements) {
+        if (id >= snapshot_.nodes_.size()) {
+            throw Exception{"Snapshot::Builder: unknown node", Exception::Type::RangeError};
+        }
+        snapshot_.slots_.push_back({0, id});
+    }
+    Entry e{};
+    e.kind  = Kind::Array;
+    e.size  = static_cast<uint32_t>(elements.size());
+    e.first = first;
+    return push(e);
+}
+
+Snapshot::NodeId Snapshot::Builder::object(std::span<const Member> members) {
+    auto const first = static_cast<uint32_t>(snapshot_.slots_.size());
+    for (auto& [key, id] : members) {
+        if (id >= snapshot_.nodes_.size()) {
+            throw Exception{"Snapshot::Builder: unknown node", Exception::Type::RangeError};
+        }
+        snapshot_.slots_.push_back({intern(key), id});
+    }
+    Entry e{};
+    e.kind  = Kind::Object;
+    e.size  = static_cast<uint32_t>(members.size());
+    e.first = first;
+    return push(e);
+}
+
+Snapshot Snapshot::Builder::build(NodeId root) && {
+    if (root >= snapshot_.nodes_.size()) {
+        throw Exception{"Snapshot::Builder: unknown node", Exception::Type::RangeError};
+    }
+    snapshot_.root_ = root;
+    interned_.clear();
+    return std::move(snapshot_);
+}
+
+
+// capture
+class Snapshot::Capturer {
+public:
+    Capturer(v8::Isolate* isolate, v8::Local<v8::Context> ctx, v8::TryCatch& vtry, size_t maxDepth)
+    : isolate_(isolate),
+      ctx_(ctx),
+      vtry_(vtry),
+      maxDepth_(maxDepth) {}
+
+    Snapshot run(v8::Local<v8::Value> value) && {
+        auto root = visit(value, 0);
+        return std::move(builder_).build(root ? *root : builder_.null());
+    }
+
+private:
+    // std::nullopt: dropped (undefined / function / symbol)
+    std::optional<NodeId> visit(v8::Local<v8::Value> value, size_t depth) {
+        if (value->IsUndefined() || value->IsFunction() || value->IsSymbol()) {
+            return std::nullopt;
+        }
+        if (value->IsNull()) {
+            return builder_.null();
+        }
+        if (value->IsBoolean()) {
+            return builder_.boolean(value->IsTrue());
+        }
+        if (value->IsNumber()) {
+            return builder_.number(value.As<v8::Number>()->Value());
+        }
+        if (value->IsString()) {
+            return builder_.string(read(value.As<v8::String>()));
+        }
+        if (!value->IsObject()) {
+            throw Exception{"Snapshot: BigInt is not supported", Exception::Type::TypeError};
+        }
+
+        auto object = value.As<v8::Object>();
+        if (depth >= maxDepth_) {
+            throw Exception{"Snapshot: maximum depth exceeded", Exception::Type::RangeError};
+        }
+        if (std::find(path_.begin(), path_.end(), object) != path_.end()) {
+            throw Exception{"Snapshot: cyclic structure", Exception::Type::TypeError};
+        }
+        path_.push_back(object);
+
+        auto const base = pending_.size();
+        auto       kind = Kind::Array;
+        if (value->IsArray()) {
+            auto     array  = value.As<v8::Array>();
+            uint32_t length = array->Length();
+            for (uint32_t i = 0; i < length; ++i) {
+                v8::HandleScope scope{isolate_};
+                auto            element = array->Get(ctx_, i);
+                Exception::rethrow(vtry_);
+                auto id = visit(element.ToLocalChecked(), depth + 1);
+                pending_.push_back({0, id ? *id : builder_.null()});
+            }
+        } else {
+            kind       = Kind::Object;
+            auto maybe = object->GetOwnPropertyNames(
+                ctx_,
+                static_cast<v8::PropertyFilter>(v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS),
+                v8::KeyConversionMode::kConvertToString
+            );
+            Exception::rethrow(vtry_);
+            auto keys = maybe.ToLocalChecked();
+            for (uint32_t i = 0; i < keys->Length(); ++i) {
+                v8::HandleScope scope{isolate_};
+                auto            key = keys->Get(ctx_, i);
+                Exception::rethrow(vtry_);
+                auto name = key.ToLocalChecked();
+                auto prop = object->Get(ctx_, name);
+                Exception::rethrow(vtry_);
+                if (auto id = visit(prop.ToLocalChecked(), depth + 1)) {
+                    pending_.push_back({builder_.intern(read(name.As<v8::String>())), *id});
+                }
+            }
+        }
+        auto id = builder_.container(kind, std::span{pending_}.subspan(base));
+        pending_.resize(base);
+        path_.pop_back();
+        return id;
+    }
+
+    std::string_view read(v8::Local<v8::String> str) {
+        buffer_.resize(static_cast<size_t>(str->Utf8Length(isolate_)));
+        str->WriteUtf8(
+            isolate_,
+            buffer_.data(),
+            static_cast<int>(buffer_.size()),
+            nullptr,
+            v8::String::NO_NULL_TERMINATION | v8::String::REPLACE_INVALID_UTF8
+        );
+        return buffer_;
+    }
+
+    v8::Isolate*           isolate_;
+    v8::Local<v8::Context> ctx_;
+    v8::TryCatch&          vtry_;
+    size_t const           maxDepth_;
+
+    Builder                            builder_;
+    std::vector<Slot>                  pending_; // children of the containers on the current path
+    std::vector<v8::Local<v8::Object>> path_;    // for cycle detection
+    std::string                        buffer_;  // reused for every string read
+};
+
+Snapshot Snapshot::capture(Local<Value> const& value, size_t maxDepth) {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    return Capturer{isolate, ctx, vtry, maxDepth}.run(ValueHelper::unwrap(value));
+}
+
+
+// parseJson
+class Snapshot::JsonParser {
+public:
+    JsonParser(std::string_view text, size_t maxDepth) : text_(text), maxDepth_(maxDepth) {}
+
+    Snapshot run() && {
+        skipSpace();
+        auto root = value(0);
+        skipSpace();
+        if (pos_ != text_.size()) {
+            fail("unexpected trailing characters");
+        }
+        return std::move(builder_).build(root);
+    }
+
+private:
+    [[noreturn]] void fail(char const* what) const {
+        throw Exception{
+            std::string{"Snapshot::parseJson: "} + what + " at offset " + std::to_string(pos_),
+            Exception::Type::SyntaxError
+        };
+    }
+
+    void skipSpace() {
+        while (pos_ < text_.size()
+               && (text_[pos_] == ' ' || text_[pos_] == '\n' || text_[pos_] == '\r' || text_[pos_] == '\t')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c) {
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c, char const* what) {
+        if (!consume(c)) {
+            fail(what);
+        }
+    }
+
+    void literal(std::string_view word) {
+        if (text_.substr(pos_, word.size()) != word) {
+            fail("invalid literal");
+        }
+        pos_ += word.size();
+    }
+
+    NodeId value(size_t depth) {
+        if (pos_ >= text_.size()) {
+            fail("unexpected end of input");
+        }
+        switch (text_[pos_]) {
+        case '{':
+            return object(depth);
+        case '[':
+            return array(depth);
+        case '"':
+            return builder_.string(string());
+        case 't':
+            literal("true");
+            return builder_.boolean(true);
+        case 'f':
+            literal("false");
+            return builder_.boolean(false);
+        case 'n':
+            literal("null");
+            return builder_.null();
+        default:
+            return builder_.number(number());
+        }
+    }
+
+    void enter(size_t depth) {
+        if (depth >= maxDepth_) {
+            throw Exception{"Snapshot::parseJson: maximum depth exceeded", Exception::Type::RangeError};
+        }
+        ++pos_; // '[' or '{'
+        skipSpace();
+    }
+
+    NodeId array(size_t depth) {
+        enter(depth);
+        auto const base = pending_.size();
+        if (!consume(']')) {
+            do {
+                skipSpace();
+                pending_.push_back({0, value(depth + 1)});
+                skipSpace();
+            } while (consume(','));
+            expect(']', "expected ',' or ']'");
+        }
+        return finish(Kind::Array, base);
+    }
+
+    NodeId object(size_t depth) {
+        enter(depth);
+        auto const base   = pending_.size();
+        auto const serial = nextObject_++;
+        if (!consume('}')) {
+            do {
+                skipSpace();
+                if (pos_ >= text_.size() || text_[pos_] != '"') {
+                    fail("expected a string key");
+                }
+                auto key = builder_.intern(string());
+                skipSpace();
+                expect(':', "expected ':'");
+                skipSpace();
+                auto id = value(depth + 1);
+
+                // a duplicate key keeps its first position and takes the last value, like JSON.parse
+                auto [entry, inserted] = keyIndex_.try_emplace(objectKey(serial, key), pending_.size());
+                if (inserted) {
+                    pending_.push_back({key, id});
+                } else {
+                    pending_[entry->second].node = id;
+                }
+                skipSpace();
+            } while (consume(','));
+            expect('}', "expected ',' or '}'");
+        }
+        for (auto const& slot : std::span{pending_}.subspan(base)) {
+            keyIndex_.erase(objectKey(serial, slot.key));
+        }
+        return finish(Kind::Object, base);
+    }
+
+    static uint64_t objectKey(uint64_t serial, uint32_t key) { return serial << 32 | key; }
+
+    NodeId finish(Kind kind, size_t base) {
+        auto id = builder_.container(kind, std::span{pending_}.subspan(base));
+        pending_.resize(base);
+        return id;
+    }
+
+    // the returned view points into the input if the string has no escapes, into buffer_ otherwise
+    std::string_view string() {
+        auto const begin = ++pos_; // opening quote
+        while (pos_ < text_.size() && text_[pos_] != '"' && text_[pos_] != '\\') {
+            if (static_cast<unsigned char>(text_[pos_]) < 0x20) {
+                fail("control character in string");
+            }
+            ++pos_;
+        }
+        if (pos_ >= text_.size()) {
+            fail("unterminated string");
+        }
+        if (text_[pos_] == '"') {
+            return text_.substr(begin, pos_++ - begin);
+        }
+
+        buffer_.assign(text_.substr(begin, pos_ - begin));
+        while (true) {
+            if (pos_ >= text_.size()) {
+                fail("unterminated string");
+            }
+            char c = text_[pos_++];
+            if (c == '"') {
+                return buffer_;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                fail("control character in string");
+            }
+            if (c != '\\') {
+                buffer_.push_back(c);
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                fail("unterminated string");
+            }
+            switch (text_[pos_++]) {
+            case '"':
+                buffer_.push_back('"');
+                break;
+            case '\\':
+                buffer_.push_back('\\');
+                break;
+            case '/':
+                buffer_.push_back('/');
+                break;
+            case 'b':
+                buffer_.push_back('\b');
+                break;
+            case 'f':
+                buffer_.push_back('\f');
+                break;
+            case 'n':
+                buffer_.push_back('\n');
+                break;
+            case 'r':
+                buffer_.push_back('\r');
+                break;
+            case 't':
+                buffer_.push_back('\t');
+                break;
+            case 'u':
+                appendUtf8(codePoint());
+                break;
+            default:
+                fail("invalid escape");
+            }
+        }
+    }
+
+    uint32_t hex4() {
+        if (text_.size() - pos_ < 4) {
+            fail("invalid unicode escape");
+        }
+        uint32_t value = 0;
+        auto [end, ec] = std::from_chars(text_.data() + pos_, text_.data() + pos_ + 4, value, 16);
+        if (ec != std::errc{} || end != text_.data() + pos_ + 4) {
+            fail("invalid unicode escape");
+        }
+        pos_ += 4;
+        return value;
+    }
+
+    uint32_t codePoint() {
+        auto unit = hex4();
+        if (unit >= 0xD800 && unit <= 0xDBFF && text_.substr(pos_, 2) == "\\u") {
+            auto const save = pos_;
+            pos_           += 2;
+            auto low        = hex4();
+            if (low >= 0xDC00 && low <= 0xDFFF) {
+                return 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+            }
+            pos_ = save; // not a pair, the lone surrogate is replaced below
+        }
+        return unit >= 0xD800 && unit <= 0xDFFF ? 0xFFFD : unit;
+    }
+
+    void appendUtf8(uint32_t cp) {
+        if (cp < 0x80) {
+            buffer_.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            buffer_.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            buffer_.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            buffer_.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            buffer_.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            buffer_.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            buffer_.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            buffer_.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            buffer_.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            buffer_.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    double number() {
+        // validate the JSON grammar first, from_chars alone would accept "+1", "01", ".5" or "inf"
+        auto const begin = pos_;
+        consume('-');
+        auto digits = [&] {
+            auto const start = pos_;
+            while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+                ++pos_;
+            }
+            return pos_ - start;
+        };
+        auto const intStart = pos_;
+        auto const intLen   = digits();
+        if (intLen == 0 || (intLen > 1 && text_[intStart] == '0')) {
+            pos_ = begin;
+            fail("invalid value");
+        }
+        if (consume('.') && digits() == 0) {
+            fail("invalid number");
+        }
+        if (consume('e') || consume('E')) {
+            if (!consume('+')) consume('-');
+            if (digits() == 0) {
+                fail("invalid number");
+            }
+        }
+        double result = 0;
+        auto [end, ec] = std::from_chars(text_.data() + begin, text_.data() + pos_, result);
+        if (ec == std::errc::result_out_of_range) {
+            // from_chars leaves the value untouched, strtod gives +-Infinity / 0 like JSON.parse
+            return std::strtod(std::string{text_.substr(begin, pos_ - begin)}.c_str(), nullptr);
+        }
+        if (ec != std::errc{} || end != text_.data() + pos_) {
+            fail("invalid number");
+        }
+        return result;
+    }
+
+    std::string_view const text_;
+    size_t const           maxDepth_;
+    size_t                 pos_{0};
+
+    Builder           builder_;
+    std::vector<Slot> pending_; // children of the containers being parsed
+    std::string       buffer_;  // unescaped string
+
+    // (object serial, interned key) -> index in pending_, for the objects on the current path
+    std::unordered_map<uint64_t, size_t> keyIndex_;
+    uint64_t                             nextObject_{0};
+};
+
+Snapshot Snapshot::parseJson(std::string_view json, size_t maxDepth) {
+    return JsonParser{json, maxDepth}.run();
+}
+
+
+// materialize
+Local<Value> Snapshot::materialize() const {
+    auto& engine = EngineScope::currentEngineChecked();
+    auto  isolate = engine.isolate();
+
+    internal::V8EscapeScope scope{isolate};
+
+    auto newString = [&](uint32_t index, v8::NewStringType type) {
+        auto                  sv = string(index);
+        v8::Local<v8::String> result;
+        if (!v8::String::NewFromUtf8(isolate, sv.data(), type, static_cast<int>(sv.size())).ToLocal(&result)) {
+            throw Exception{"Snapshot: string is too long", Exception::Type::RangeError};
+        }
+        return result;
+    };
+
+    std::vector<v8::Local<v8::String>> values(strings_.size());
+    std::vector<v8::Local<v8::String>> keys(strings_.size());
+    std::vector<v8::Local<v8::Value>>  nodes(nodes_.size());
+
+    std::vector<v8::Local<v8::Name>>  names;
+    std::vector<v8::Local<v8::Value>> elements;
+
+    auto prototype = engine.objectPrototype();
+    // children precede their parent, so one forward pass sees every child before it is used
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        auto& e = nodes_[i];
+        switch (e.kind) {
+        case Kind::Null:
+            nodes[i] = v8::Null(isolate);
+            break;
+        case Kind::Boolean:
+            nodes[i] = v8::Boolean::New(isolate, e.boolean);
+            break;
+        case Kind::Number:
+            nodes[i] = v8::Number::New(isolate, e.number);
+            break;
+        case Kind::String:
+            if (values[e.string].IsEmpty()) {
+                values[e.string] = newString(e.string, v8::NewStringType::kNormal);
+            }
+            nodes[i] = values[e.string];
+            break;
+        case Kind::Array:
+            elements.clear();
+            for (uint32_t k = 0; k < e.size; ++k) {
+                elements.push_back(nodes[slots_[e.first + k].node]);
+            }
+            nodes[i] = v8::Array::New(isolate, elements.data(), elements.size());
+            break;
+        case Kind::Object:
+            names.clear();
+            elements.clear();
+            for (uint32_t k = 0; k < e.size; ++k) {
+                auto& slot = slots_[e.first + k];
+                if (keys[slot.key].IsEmpty()) {
+                    keys[slot.key] = newString(slot.key, v8::NewStringType::kInternalized);
+                }
+                names.push_back(keys[slot.key]);
+                elements.push_back(nodes[slot.node]);
+            }
+            nodes[i] = v8::Object::New(isolate, prototype, names.data(), elements.data(), names.size());
+            break;
+        }
+    }
+    return ValueHelper::wrap<Value>(scope.escape(nodes[root_]));
+}
+
+
+} // namespace v8kit
@@ -0,0 +1,196 @@
+#pragma once
+#include "Fwd.h"
+
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace v8kit {
+
+/**
+ * @brief Immutable, engine-independent copy of a JS value graph (JSON data model)
+ * @note All nodes live in one flat array and all strings in one interned pool, so a snapshot is a handful of
+ *       allocations no matter how large the graph is. Once captured it can be read from any thread without the engine.
+ * @note Captured like JSON.stringify: undefined / functions / symbols are dropped from objects and become null in
+ *       arrays, only own enumerable string keys are kept, BigInt and cycles are rejected.
+ *
+ * @example
+ * Snapshot snap;
+ * { EngineScope scope{engine}; snap = Snapshot::capture(value); } // engine is free again
+ * pool.submit([snap = std::move(snap)] { process(snap.root()); });
+ */
+class Snapshot {
+public:
+    enum class Kind : uint8_t { Null, Boolean, Number, String, Array, Object };
+
+    using NodeId = uint32_t;
+
+    class Builder;
+
+    /**
+     * @brief Read-only handle to one node, valid while the snapshot is alive
+     */
+    class Node {
+    public:
+        [[nodiscard]] Kind kind() const;
+
+        [[nodiscard]] bool isNull() const { return kind() == Kind::Null; }
+        [[nodiscard]] bool isBoolean() const { return kind() == Kind::Boolean; }
+        [[nodiscard]] bool isNumber() const { return kind() == Kind::Number; }
+        [[nodiscard]] bool isString() const { return kind() == Kind::String; }
+        [[nodiscard]] bool isArray() const { return kind() == Kind::Array; }
+        [[nodiscard]] bool isObject() const { return kind() == Kind::Object; }
+
+        /**
+         * @note the accessors below throw a TypeError on a kind mismatch
+         */
+        [[nodiscard]] bool             asBoolean() const;
+        [[nodiscard]] double           asNumber() const;
+        [[nodiscard]] std::string_view asString() const;
+
+        /**
+         * @return number of elements (array) or entries (object), 0 otherwise
+         */
+        [[nodiscard]] size_t size() const;
+
+        [[nodiscard]] Node operator[](size_t index) const; // array element or object entry value
+
+        [[nodiscard]] std::string_view keyAt(size_t index) const; // object entry key
+
+        /**
+         * @brief Look up an object entry by key (linear, entries keep their insertion order)
+         */
+        [[nodiscard]] std::optional<Node> find(std::string_view key) const;
+
+    private:
+        friend Snapshot;
+
+        Node(Snapshot const* owner, NodeId id) : owner_(owner), id_(id) {}
+
+        Snapshot const* owner_;
+        NodeId          id_;
+    };
+
+    Snapshot(); // a single null
+
+    Snapshot(Snapshot&&) noexcept            = default;
+    Snapshot& operator=(Snapshot&&) noexcept = default;
+    Snapshot(Snapshot const&)                = default;
+    Snapshot& operator=(Snapshot const&)     = default;
+    ~Snapshot()                              = default;
+
+    [[nodiscard]] Node root() const { return Node{this, root_}; }
+
+    [[nodiscard]] size_t nodeCount() const { return nodes_.size(); }
+
+    /**
+     * @brief Copy `value` out of the engine (requires an EngineScope)
+     * @param maxDepth nesting limit, exceeding it throws a RangeError
+     */
+    [[nodiscard]] static Snapshot capture(Local<Value> const& value, size_t maxDepth = 64);
+
+    /**
+     * @brief Parse JSON text natively, without an engine (no JS objects are created)
+     * @note malformed input throws a SyntaxError, duplicate keys keep the last value (like JSON.parse)
+     */
+    [[nodiscard]] static Snapshot parseJson(std::string_view json, size_t maxDepth = 64);
+
+    /**
+     * @brief Recreate the value in the current engine in one pass (requires an EngineScope)
+     * @note strings are created once per distinct string, object keys are internalized
+     */
+    [[nodiscard]] Local<Value> materialize() const;
+
+private:
+    struct Empty {};
+    explicit Snapshot(Empty) {}
+
+    class Capturer;
+    class JsonParser;
+
+    struct Entry {
+        Kind     kind;
+        uint32_t size{0}; // children count (array / object)
+        union {
+            bool     boolean;
+            double   number;
+            uint32_t string; // index into strings_
+            uint32_t first;  // index of the first child in slots_
+        };
+    };
+    struct Slot {
+        uint32_t key; // index into strings_, object entries only
+        NodeId   node;
+    };
+    struct StringRef {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    [[nodiscard]] Entry const&     entry(NodeId id) const { return nodes_[id]; }
+    [[nodiscard]] std::string_view string(uint32_t index) const;
+
+    std::vector<Entry>     nodes_;   // children always precede their parent
+    std::vector<Slot>      slots_;   // children of every array / object, contiguous per parent
+    std::vector<StringRef> strings_; // distinct strings
+    std::string            pool_;    // characters of all strings_
+    NodeId                 root_{0};
+};
+
+
+/**
+ * @brief Builds a Snapshot bottom-up without an engine, e.g. on a worker thread, for a later materialize()
+ * @note every node has to be created before the array / object that contains it
+ *
+ * @example
+ * Snapshot::Builder b;
+ * auto items = b.array({b.number(1), b.number(2)});
+ * Snapshot snap = std::move(b).build(b.object({{"items", items}, {"ok", b.boolean(true)}}));
+ */
+class Snapshot::Builder {
+public:
+    struct Member {
+        std::string_view key;
+        NodeId           value;
+    };
+
+    NodeId null();
+    NodeId boolean(bool value);
+    NodeId number(double value);
+    NodeId string(std::string_view value);
+    NodeId array(std::span<const NodeId> elements);
+    NodeId array(std::initializer_list<NodeId> elements) { return array(std::span{elements.begin(), elements.size()}); }
+
+    /**
+     * @note keys should be unique
+     */
+    NodeId object(std::span<const Member> members);
+    NodeId object(std::initializer_list<Member> members) { return object(std::span{members.begin(), members.size()}); }
+
+    [[nodiscard]] Snapshot build(NodeId root) &&;
+
+private:
+    friend Snapshot;
+    friend class Snapshot::Capturer;
+    friend class Snapshot::JsonParser;
+
+    struct TransparentHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view sv) const noexcept { return std::hash<std::string_view>{}(sv); }
+    };
+
+    uint32_t intern(std::string_view value);
+    NodeId   push(Entry entry);
+    NodeId   container(Kind kind, std::span<const Slot> slots);
+
+    Snapshot                                                                    snapshot_{Empty{}};
+    std::unordered_map<std::string, uint32_t, TransparentHash, std::equal_to<>> interned_;
+};
+
+} // namespace v8kit
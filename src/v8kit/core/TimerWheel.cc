@@ -0,0 +1,113 @@
+#include "TimerWheel.h"
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace v8kit {
+
+namespace {
+
+constexpr uint64_t kSlotMask = TimerWheel::kSlots - 1;
+constexpr uint64_t kSpan     = uint64_t{1} << (TimerWheel::kSlotBits * TimerWheel::kLevels);
+
+constexpr uint64_t levelSpan(size_t level) { return uint64_t{1} << (TimerWheel::kSlotBits * level); }
+
+} // namespace
+
+
+TimerWheel::TimerWheel(Clock::time_point origin) : origin_(origin) {}
+
+void TimerWheel::schedule(TimerId id, Clock::time_point deadline) {
+    cancel(id);
+
+    uint64_t tick = 0;
+    if (deadline > origin_) {
+        tick = static_cast<uint64_t>(std::chrono::ceil<std::chrono::milliseconds>(deadline - origin_).count());
+    }
+    insert(Entry{id, tick});
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    auto iter = index_.find(id);
+    if (iter == index_.end()) {
+        return false;
+    }
+    auto const& location = iter->second;
+    wheels_[location.level_][location.slot_].erase(location.entry_);
+    index_.erase(iter);
+    return true;
+}
+
+void TimerWheel::insert(Entry entry) {
+    uint64_t expire = std::max(entry.expire_, current_);
+    uint64_t delta  = expire - current_;
+
+    size_t level = 0;
+    while (level + 1 < kLevels && delta >= levelSpan(level + 1)) {
+        ++level;
+    }
+    // beyond one revolution: park in the farthest slot, the next cascade re-inserts it with the real deadline
+    uint64_t slotTick = std::min(expire, current_ + kSpan - 1);
+    size_t   slot     = static_cast<size_t>((slotTick >> (kSlotBits * level)) & kSlotMask);
+
+    auto& list        = wheels_[level][slot];
+    auto  position    = list.insert(list.end(), entry);
+    index_[entry.id_] = Location{level, slot, position};
+}
+
+void TimerWheel::cascade(size_t level) {
+    auto& list = wheels_[level][static_cast<size_t>((current_ >> (kSlotBits * level)) & kSlotMask)];
+    Slot  moving;
+    moving.swap(list);
+    for (auto const& entry : moving) {
+        insert(entry); // lands on a lower level, or back on this one if it is still beyond the span
+    }
+}
+
+void TimerWheel::advance(Clock::time_point now, std::vector<TimerId>& expired) {
+    if (now < origin_) {
+        return;
+    }
+    auto target = static_cast<uint64_t>(std::chrono::floor<std::chrono::milliseconds>(now - origin_).count());
+    while (current_ <= target) {
+        if (index_.empty()) {
+            current_ = target + 1; // nothing to expire on the way
+            break;
+        }
+        for (size_t level = 1; level < kLevels && (current_ & (levelSpan(level) - 1)) == 0; ++level) {
+            cascade(level);
+        }
+        auto& list = wheels_[0][static_cast<size_t>(current_ & kSlotMask)];
+        for (auto const& entry : list) {
+            assert(entry.expire_ <= current_);
+            expired.push_back(entry.id_);
+            index_.erase(entry.id_);
+        }
+        list.clear();
+        ++current_;
+    }
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::nextWakeup() const {
+    if (index_.empty()) {
+        return std::nullopt;
+    }
+    // a cascade still pending on the current tick may bring anything down
+    for (size_t level = 1; level < kLevels && (current_ & (levelSpan(level) - 1)) == 0; ++level) {
+        if (!wheels_[level][static_cast<size_t>((current_ >> (kSlotBits * level)) & kSlotMask)].empty()) {
+            return origin_ + std::chrono::milliseconds{current_};
+        }
+    }
+    // level 0 holds everything due before the next cascade, which may bring earlier timers down
+    uint64_t cascadeTick = (current_ | kSlotMask) + 1;
+    for (uint64_t tick = current_; tick < cascadeTick; ++tick) {
+        if (!wheels_[0][static_cast<size_t>(tick & kSlotMask)].empty()) {
+            return origin_ + std::chrono::milliseconds{tick};
+        }
+    }
+    return origin_ + std::chrono::milliseconds{cascadeTick};
+}
+
+
+} // namespace v8kit
@@ -0,0 +1,90 @@
+#pragma once
+#include "v8kit/Macro.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+
+namespace v8kit {
+
+using TimerId = uint64_t;
+
+/**
+ * @brief Hierarchical timing wheel with millisecond ticks, tracks when timers expire (not what they run)
+ * @note 4 levels of 256 slots cover 2^32 ms (~49 days) per revolution, later deadlines park on the top level and
+ *       come back down until they are due. schedule() / cancel() are O(1); advance() costs one step per elapsed tick
+ *       plus a cascade every 256 ticks.
+ * @note Not thread-safe, the engine drives it from its thread (Engine::setTimer).
+ */
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kLevels   = 4;
+    static constexpr size_t kSlotBits = 8;
+    static constexpr size_t kSlots    = size_t{1} << kSlotBits;
+
+    explicit TimerWheel(Clock::time_point origin = Clock::now());
+
+    V8KIT_DISABLE_COPY(TimerWheel);
+
+    TimerWheel(TimerWheel&&) noexcept            = default;
+    TimerWheel& operator=(TimerWheel&&) noexcept = default;
+
+    /**
+     * @param deadline rounded up to the next tick (never expires early); a deadline at or before the last advance()
+     *        is due on the wheel's next tick, so it expires once advance() reaches the following millisecond
+     * @note an id that is already scheduled is moved to the new deadline
+     */
+    void schedule(TimerId id, Clock::time_point deadline);
+
+    /**
+     * @return false if `id` is not scheduled (expired or never scheduled)
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Expire every timer due at `now`, their ids are appended to `expired` in deadline order (per tick)
+     */
+    void advance(Clock::time_point now, std::vector<TimerId>& expired);
+
+    /**
+     * @return a point in time no later than the next expiry, std::nullopt if nothing is scheduled
+     * @note it may be an earlier cascade point, advancing to it then expires nothing
+     */
+    [[nodiscard]] std::optional<Clock::time_point> nextWakeup() const;
+
+    [[nodiscard]] size_t size() const { return index_.size(); }
+
+    [[nodiscard]] bool empty() const { return index_.empty(); }
+
+private:
+    struct Entry {
+        TimerId  id_;
+        uint64_t expire_; // tick, may lie beyond the wheel span
+    };
+    using Slot = std::list<Entry>;
+
+    struct Location {
+        size_t         level_;
+        size_t         slot_;
+        Slot::iterator entry_;
+    };
+
+    void insert(Entry entry);
+    void cascade(size_t level);
+
+    Clock::time_point                             origin_;
+    uint64_t                                      current_{0}; // next tick to expire
+    std::array<std::array<Slot, kSlots>, kLevels> wheels_;
+    std::unordered_map<TimerId, Location>         index_;
+};
+
+
+} // namespace v8kit
@@ -3,9 +3,11 @@
 #include "v8kit/Macro.h"
 
 V8KIT_WARNING_GUARD_BEGIN
+#include <v8-container.h>
 #include <v8-function.h>
 #include <v8-object.h>
 #include <v8-primitive.h>
+#include <v8-promise.h>
 #include <v8-value.h>
 V8KIT_WARNING_GUARD_END
 
@@ -39,6 +41,10 @@ TYPE_ALIAS(Symbol, v8::Symbol);
 TYPE_ALIAS(Function, v8::Function);
 TYPE_ALIAS(Object, v8::Object);
 TYPE_ALIAS(Array, v8::Array);
+TYPE_ALIAS(Map, v8::Map);
+TYPE_ALIAS(Set, v8::Set);
+TYPE_ALIAS(Promise, v8::Promise);
+TYPE_ALIAS(PromiseResolver, v8::Promise::Resolver);
 
 
 #undef TYPE_ALIAS
@@ -10,11 +10,13 @@
 
 
 V8KIT_WARNING_GUARD_BEGIN
+#include <v8-container.h>
 #include <v8-exception.h>
 #include <v8-external.h>
 #include <v8-function-callback.h>
 #include <v8-local-handle.h>
 #include <v8-primitive.h>
+#include <v8-promise.h>
 #include <v8-template.h>
 #include <v8-value.h>
 V8KIT_WARNING_GUARD_END
@@ -106,9 +108,11 @@ Local<Function> Function::newFunction(FunctionCallback&& cb) {
     auto vtry = v8::TryCatch{isolate};
     auto data = std::make_unique<AssociateResources>(EngineScope::currentEngine(), std::move(cb));
 
+    // v8::Function::New instead of a FunctionTemplate per call: a template yields one function per context and
+    // every instantiated template stays in the context's instantiation cache, Function::New bypasses that cache
     auto external = v8::External::New(isolate, static_cast<void*>(data.get())).As<v8::Value>();
-    auto temp     = v8::FunctionTemplate::New(
-        isolate,
+    auto v8Func   = v8::Function::New(
+        ctx,
         [](v8::FunctionCallbackInfo<v8::Value> const& info) {
             auto data = reinterpret_cast<AssociateResources*>(info.Data().As<v8::External>()->Value());
             auto args = Arguments{data->runtime, info};
@@ -119,11 +123,10 @@ Local<Function> Function::newFunction(FunctionCallback&& cb) {
                 e.rethrowToRuntime(); // throw to v8 (js)
             }
         },
-        external
+        external,
+        0,
+        v8::ConstructorBehavior::kThrow
     );
-    temp->RemovePrototype();
-
-    auto v8Func = temp->GetFunction(ctx);
     Exception::rethrow(vtry);
 
     EngineScope::currentEngineChecked().addManagedResource(data.release(), v8Func.ToLocalChecked(), [](void* data) {
@@ -138,12 +141,70 @@ Local<Object> Object::newObject() {
     auto isolate = EngineScope::currentEngineIsolateChecked();
     return Local<Object>{v8::Object::New(isolate)};
 }
+Local<Object> Object::newObject(std::span<const Local<String>> keys, std::span<const Local<Value>> values) {
+    if (keys.size() != values.size()) {
+        throw Exception{"Object::newObject: keys and values must have the same size", Exception::Type::RangeError};
+    }
+    auto& engine = EngineScope::currentEngineChecked();
+    if (keys.empty()) {
+        return Local<Object>{v8::Object::New(engine.isolate_)};
+    }
+    static_assert(sizeof(Local<String>) == sizeof(v8::Local<v8::Name>));
+    static_assert(sizeof(Local<Value>) == sizeof(v8::Local<v8::Value>));
+    auto names = reinterpret_cast<v8::Local<v8::Name>*>(const_cast<Local<String>*>(keys.data()));
+    auto vals  = reinterpret_cast<v8::Local<v8::Value>*>(const_cast<Local<Value>*>(values.data()));
+    return Local<Object>{v8::Object::New(engine.isolate_, engine.objectPrototype(), names, vals, keys.size())};
+}
 
 
 Local<Array> Array::newArray(size_t length) {
     auto isolate = EngineScope::currentEngineIsolateChecked();
     return Local<Array>{v8::Array::New(isolate, static_cast<int>(length))};
 }
+Local<Array> Array::newArray(std::span<const Local<Value>> elements) {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+    if (elements.empty()) {
+        return Local<Array>{v8::Array::New(isolate, 0)};
+    }
+    static_assert(
+        sizeof(Local<Value>) == sizeof(v8::Local<v8::Value>),
+        "Local<Value> must be binary-compatible with v8::Local<v8::Value>"
+    );
+    auto raw = reinterpret_cast<v8::Local<v8::Value>*>(const_cast<Local<Value>*>(elements.data()));
+    return Local<Array>{v8::Array::New(isolate, raw, elements.size())};
+}
+
+
+Local<Map> Map::newMap() {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+    return Local<Map>{v8::Map::New(isolate)};
+}
+
+Local<Set> Set::newSet() {
+    auto isolate = EngineScope::currentEngineIsolateChecked();
+    return Local<Set>{v8::Set::New(isolate)};
+}
+
+
+Local<Promise> Promise::newResolved(Local<Value> const& value) {
+    auto resolver = PromiseResolver::newResolver();
+    resolver.resolve(value);
+    return resolver.getPromise();
+}
+Local<Promise> Promise::newRejected(Local<Value> const& reason) {
+    auto resolver = PromiseResolver::newResolver();
+    resolver.reject(reason);
+    return resolver.getPromise();
+}
+
+
+Local<PromiseResolver> PromiseResolver::newResolver() {
+    auto&& [isolate, ctx] = EngineScope::currentIsolateAndContextChecked();
+    v8::TryCatch vtry{isolate};
+    auto         maybe = v8::Promise::Resolver::New(ctx);
+    Exception::rethrow(vtry);
+    return Local<PromiseResolver>{maybe.ToLocalChecked()};
+}
 
 
 Arguments::Arguments(Engine* engine, v8::FunctionCallbackInfo<v8::Value> const& args) : engine_(engine), args_(args) {}
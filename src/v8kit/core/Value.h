@@ -3,6 +3,7 @@
 #include "V8TypeAlias.h"
 #include "v8kit/Macro.h"
 
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -24,6 +25,15 @@ enum class ValueKind : uint8_t {
     kObject,
     kArray,
     kFunction,
+    kMap,
+    kSet,
+    kPromise,
+};
+
+enum class PromiseState : uint8_t {
+    kPending,
+    kFulfilled,
+    kRejected,
 };
 
 class Value {
@@ -96,12 +106,55 @@ class Object : public Value {
 public:
     Object() = delete;
     [[nodiscard]] static Local<Object> newObject();
+
+    /**
+     * Create a plain object with all properties in one step (v8::Object::New(isolate, proto, names, values, n)).
+     * @note keys and values must have the same size, keys should be unique
+     */
+    [[nodiscard]] static Local<Object>
+    newObject(std::span<const Local<String>> keys, std::span<const Local<Value>> values);
 };
 
 class Array : public Value {
 public:
     Array() = delete;
     [[nodiscard]] static Local<Array> newArray(size_t length = 0);
+
+    /**
+     * Create an array from already converted elements in one step (v8::Array::New(isolate, elements, count)).
+     * @note much cheaper than newArray(n) followed by n calls to Local<Array>::set
+     */
+    [[nodiscard]] static Local<Array> newArray(std::span<const Local<Value>> elements);
+};
+
+class Map : public Value {
+public:
+    Map() = delete;
+    [[nodiscard]] static Local<Map> newMap();
+};
+
+class Set : public Value {
+public:
+    Set() = delete;
+    [[nodiscard]] static Local<Set> newSet();
+};
+
+class Promise : public Value {
+public:
+    Promise() = delete;
+    [[nodiscard]] static Local<Promise> newResolved(Local<Value> const& value);
+    [[nodiscard]] static Local<Promise> newRejected(Local<Value> const& reason);
+};
+
+class PromiseResolver : public Value {
+public:
+    PromiseResolver() = delete;
+
+    /**
+     * Create a pending promise together with the capability to settle it (v8::Promise::Resolver).
+     * @note keep it in a Global<PromiseResolver> to settle it later, e.g. from an Engine::postTask task
+     */
+    [[nodiscard]] static Local<PromiseResolver> newResolver();
 };
 
 class Engine; // forward declaration
@@ -0,0 +1,85 @@
+#pragma once
+#include "Fwd.h"
+
+#include <cstdint>
+#include <optional>
+
+namespace v8kit {
+
+/**
+ * @brief Backing store of an array-like view (see Engine::newIndexedView)
+ * @note Elements are read and written through the handler on every access, nothing is copied up front.
+ */
+class IndexedViewHandler {
+public:
+    IndexedViewHandler()          = default;
+    virtual ~IndexedViewHandler() = default;
+
+    V8KIT_DISABLE_COPY(IndexedViewHandler);
+
+    [[nodiscard]] virtual uint32_t length() const = 0;
+
+    /**
+     * @note only called with index < length()
+     */
+    [[nodiscard]] virtual Local<Value> get(uint32_t index) = 0;
+
+    /**
+     * @note called for any index; throw an Exception to reject the write
+     */
+    virtual void set(uint32_t index, Local<Value> const& value) = 0;
+};
+
+/**
+ * @brief Backing store of a dictionary-like view (see Engine::newNamedView)
+ */
+class NamedViewHandler {
+public:
+    NamedViewHandler()          = default;
+    virtual ~NamedViewHandler() = default;
+
+    V8KIT_DISABLE_COPY(NamedViewHandler);
+
+    [[nodiscard]] virtual bool has(Local<String> const& key) const = 0;
+
+    /**
+     * @return std::nullopt if the key does not exist (one lookup per property read)
+     */
+    [[nodiscard]] virtual std::optional<Local<Value>> get(Local<String> const& key) = 0;
+
+    /**
+     * @note throw an Exception to reject the write
+     */
+    virtual void set(Local<String> const& key, Local<Value> const& value) = 0;
+
+    /**
+     * @return false if the key does not exist
+     */
+    virtual bool remove(Local<String> const& key) = 0;
+
+    [[nodiscard]] virtual Local<Array> keys() const = 0;
+};
+
+/**
+ * @brief Source of a native iterator (see Engine::newIterator), pulled by the script one `next()` at a time
+ */
+class IteratorHandler {
+public:
+    IteratorHandler()          = default;
+    virtual ~IteratorHandler() = default;
+
+    V8KIT_DISABLE_COPY(IteratorHandler);
+
+    /**
+     * @return the next value, std::nullopt once exhausted
+     */
+    [[nodiscard]] virtual std::optional<Local<Value>> next() = 0;
+
+    /**
+     * @brief The script stopped iterating early (`break`, `return`, destructuring), release what you can
+     * @note next() must report exhaustion afterwards
+     */
+    virtual void close() {}
+};
+
+} // namespace v8kit
@@ -0,0 +1,65 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+#include <utility>
+
+
+namespace v8kit {
+
+
+WorkerPool::WorkerPool(size_t threads, size_t maxQueued) : maxQueued_(maxQueued) {
+    if (threads == 0) {
+        threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    }
+    threads_.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back([this] { workerMain(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock{mutex_};
+        stopping_ = true;
+    }
+    ready_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+bool WorkerPool::trySubmit(std::function<void()> job) {
+    {
+        std::lock_guard lock{mutex_};
+        if (stopping_ || jobs_.size() >= maxQueued_) {
+            return false;
+        }
+        jobs_.push_back(std::move(job));
+    }
+    ready_.notify_one();
+    return true;
+}
+
+size_t WorkerPool::queued() const {
+    std::lock_guard lock{mutex_};
+    return jobs_.size();
+}
+
+void WorkerPool::workerMain() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock lock{mutex_};
+            ready_.wait(lock, [this] { return stopping_ || !jobs_.empty(); });
+            if (jobs_.empty()) {
+                return; // stopping and drained
+            }
+            job = std::move(jobs_.front());
+            jobs_.pop_front();
+        }
+        job();
+    }
+}
+
+
+} // namespace v8kit
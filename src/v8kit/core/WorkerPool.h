@@ -0,0 +1,72 @@
+#pragma once
+#include "v8kit/Macro.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace v8kit {
+
+/**
+ * @brief Cooperative cancellation flag of an async call (see Engine::runAsync), copies share the flag
+ * @note Functions bound with func_async / method_async may take one as their last parameter and poll it.
+ */
+class CancellationToken {
+public:
+    CancellationToken() : state_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    [[nodiscard]] bool isCancelled() const noexcept { return state_->load(std::memory_order_acquire); }
+
+    void cancel() const noexcept { state_->store(true, std::memory_order_release); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> state_;
+};
+
+/**
+ * @brief Fixed-size thread pool with a bounded job queue, runs the native half of async calls
+ * @note Jobs never enter the engine, they hand a completion back to the engine thread (Engine::runAsync).
+ */
+class WorkerPool {
+public:
+    static constexpr size_t kDefaultMaxQueued = 1024;
+
+    /**
+     * @param threads 0 for std::thread::hardware_concurrency()
+     * @param maxQueued jobs waiting for a thread, trySubmit() refuses more
+     */
+    explicit WorkerPool(size_t threads = 0, size_t maxQueued = kDefaultMaxQueued);
+
+    ~WorkerPool(); // runs the jobs still queued, then joins
+
+    V8KIT_DISABLE_COPY_MOVE(WorkerPool);
+
+    /**
+     * @return false if the queue is full (backpressure), the job is then dropped
+     */
+    [[nodiscard]] bool trySubmit(std::function<void()> job);
+
+    [[nodiscard]] size_t threadCount() const { return threads_.size(); }
+
+    [[nodiscard]] size_t queued() const;
+
+private:
+    void workerMain();
+
+    mutable std::mutex                mutex_;
+    std::condition_variable           ready_;
+    std::deque<std::function<void()>> jobs_;
+    size_t const                      maxQueued_;
+    bool                              stopping_{false};
+    std::vector<std::thread>          threads_;
+};
+
+
+} // namespace v8kit
@@ -12,7 +12,20 @@
 #include "catch2/matchers/catch_matchers.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
 #include <iostream>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 
 namespace ut {
@@ -378,6 +391,598 @@ TEST_CASE_METHOD(BindingTestFixture, "overload and builder mode compatibility")
 }
 
 
+class ScratchArgsClass {
+public:
+    static std::string concat(std::string_view lhs, std::string_view rhs) { return std::string{lhs}.append(rhs); }
+    static double      sum(std::span<const double> values) { return std::accumulate(values.begin(), values.end(), 0.); }
+    static int         count(std::span<const std::string_view> words) { return static_cast<int>(words.size()); }
+    static std::string join(std::pmr::vector<std::pmr::string> const& parts) {
+        std::string result;
+        for (auto const& part : parts) result.append(part);
+        return result;
+    }
+};
+auto ScratchArgsMeta = defClass<void>("ScratchArgs")
+                           .func("concat", &ScratchArgsClass::concat)
+                           .func("sum", &ScratchArgsClass::sum)
+                           .func("count", &ScratchArgsClass::count)
+                           .func("join", &ScratchArgsClass::join)
+                           .build();
+TEST_CASE_METHOD(BindingTestFixture, "scratch arena arguments") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(ScratchArgsMeta);
+
+    REQUIRE_EVAL("ScratchArgs.concat('hello ', '世界') === 'hello 世界'", "string_view");
+    REQUIRE_EVAL("ScratchArgs.concat('', '') === ''", "empty string_view");
+    REQUIRE_EVAL("ScratchArgs.sum([1, 2.5, 3]) === 6.5", "span<const double>");
+    REQUIRE_EVAL("ScratchArgs.count(['a', 'b', 'c']) === 3", "span<const string_view>");
+    REQUIRE_EVAL("ScratchArgs.join(['x'.repeat(600), 'y']) === 'x'.repeat(600) + 'y'", "pmr::vector, heap fallback");
+    REQUIRE_THROWS_AS(engine->eval(String::newString("ScratchArgs.sum(1)")), Exception);
+}
+
+
+struct CowConfig {
+    int value_{1};
+
+    CowConfig() = default;
+
+    int  getValue() const { return value_; }
+    void setValue(int value) { value_ = value; }
+};
+struct CowOwner {
+    CowConfig config_;
+
+    CowOwner() = default;
+
+    CowConfig& config() { return config_; }
+    int        configValue() const { return config_.value_; }
+};
+auto CowConfigMeta = defClass<CowConfig>("CowConfig")
+                         .ctor()
+                         .method("getValue", &CowConfig::getValue)
+                         .method("setValue", &CowConfig::setValue)
+                         .build();
+auto CowOwnerMeta = defClass<CowOwner>("CowOwner")
+                        .ctor()
+                        .method("config", &CowOwner::config, ReturnValuePolicy::kCopyOnWrite)
+                        .method("configValue", &CowOwner::configValue)
+                        .build();
+TEST_CASE_METHOD(BindingTestFixture, "ReturnValuePolicy::kCopyOnWrite") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(CowConfigMeta);
+    engine->registerClass(CowOwnerMeta);
+
+    engine->eval(String::newString("var owner = new CowOwner(); var cfg = owner.config();"));
+    REQUIRE_EVAL("cfg.getValue() === 1", "shared read");
+
+    auto  owner  = engine->globalThis().get(String::newString("owner"));
+    auto* native = engine->getInstancePayload(owner.asObject())->unwrap<CowOwner>();
+    native->config_.value_ = 2;
+    REQUIRE_EVAL("cfg.getValue() === 2", "not detached yet, reads the source");
+
+    engine->eval(String::newString("cfg.setValue(5)"));
+    REQUIRE_EVAL("cfg.getValue() === 5", "private copy after write");
+    REQUIRE_EVAL("owner.configValue() === 2", "source untouched");
+    REQUIRE(native->config_.value_ == 2);
+}
+
+
+class Entity {
+public:
+    int id_;
+
+    explicit Entity(int id) : id_(id) {}
+
+    int getId() const { return id_; }
+};
+std::vector<Entity> queryEntities(int count) {
+    std::vector<Entity> result;
+    for (int i = 0; i < count; ++i) result.emplace_back(i);
+    return result;
+}
+std::vector<Entity*> borrowEntities() {
+    static Entity first{100}, second{200};
+    return {&first, nullptr, &second};
+}
+auto EntityMeta      = defClass<Entity>("Entity").ctor<int>().method("getId", &Entity::getId).build();
+auto EntityQueryMeta = defClass<void>("EntityQuery")
+                           .func("query", &queryEntities)
+                           .func("borrow", &borrowEntities, ReturnValuePolicy::kReference)
+                           .build();
+TEST_CASE_METHOD(BindingTestFixture, "batch wrapping of native collections") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(EntityMeta);
+    engine->registerClass(EntityQueryMeta);
+
+    REQUIRE_EVAL("EntityQuery.query(1000).length === 1000", "length");
+    REQUIRE_EVAL("EntityQuery.query(3)[2].getId() === 2", "element value");
+    REQUIRE_EVAL("EntityQuery.query(2).every(e => e instanceof Entity)", "instanceof");
+    REQUIRE_EVAL("EntityQuery.query(0).length === 0", "empty");
+
+    REQUIRE_EVAL("EntityQuery.borrow()[1] === null", "null pointer");
+    REQUIRE_EVAL("EntityQuery.borrow()[2].getId() === 200", "reference");
+    engine->gc();
+}
+
+
+class Inventory {
+public:
+    std::vector<int>                     items_{1, 2, 3};
+    std::unordered_map<std::string, int> tags_{{"a", 1}, {"b", 2}};
+
+    Inventory() = default;
+
+    VectorView<int>           items() { return VectorView{items_}; }
+    VectorView<int const>     itemsReadonly() const { return VectorView{items_}; }
+    MapView<std::string, int> tags() { return MapView{tags_}; }
+
+    int itemAt(int index) const { return items_.at(index); }
+    int itemCount() const { return static_cast<int>(items_.size()); }
+    int tagCount() const { return static_cast<int>(tags_.size()); }
+};
+auto InventoryMeta = defClass<Inventory>("Inventory")
+                         .ctor<>()
+                         .method("items", &Inventory::items)
+                         .method("itemsReadonly", &Inventory::itemsReadonly)
+                         .method("tags", &Inventory::tags)
+                         .method("itemAt", &Inventory::itemAt)
+                         .method("itemCount", &Inventory::itemCount)
+                         .method("tagCount", &Inventory::tagCount)
+                         .build();
+TEST_CASE_METHOD(BindingTestFixture, "live container views") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(InventoryMeta);
+    engine->eval(String::newString("globalThis.inv = new Inventory(); globalThis.items = inv.items();"));
+
+    REQUIRE_EVAL("items.length === 3 && items[0] === 1 && items[3] === undefined", "read");
+    REQUIRE_EVAL("(items[1] = 42, inv.itemAt(1) === 42)", "write through");
+    REQUIRE_EVAL("(items[3] = 7, inv.itemCount() === 4 && items.length === 4)", "append");
+    REQUIRE_EVAL("[...items].join() === '1,42,3,7'", "iterate");
+    REQUIRE_EVAL("Object.keys(items).length === 4", "keys");
+    REQUIRE_THROWS(engine->eval(String::newString("inv.itemsReadonly()[0] = 5")));
+    REQUIRE_EVAL("inv.itemAt(0) === 1", "readonly");
+
+    engine->eval(String::newString("globalThis.tags = inv.tags();"));
+    REQUIRE_EVAL("tags.a === 1 && 'b' in tags && !('c' in tags)", "map read");
+    REQUIRE_EVAL("(tags.c = 3, inv.tagCount() === 3)", "map write");
+    REQUIRE_EVAL("delete tags.a && inv.tagCount() === 2", "map delete");
+    REQUIRE_EVAL("Object.keys(tags).sort().join() === 'b,c'", "map keys");
+    REQUIRE_EVAL("typeof tags.toString === 'function'", "prototype lookup");
+
+    // receivers other than the view itself: the handler comes from the holder
+    REQUIRE_EVAL("Object.create(items)[1] === 42 && Object.create(items).length === 4", "Object.create");
+    REQUIRE_EVAL("Reflect.get(items, 3, {}) === 7 && Reflect.get(tags, 'b', {}) === 2", "Reflect.get receiver");
+    REQUIRE_EVAL("(o => (Object.setPrototypeOf(o, tags), o.c === 3 && 'b' in o))({})", "view as prototype");
+    REQUIRE_EVAL("(d => (d[0] = 9, d[0] === 9 && items[0] === 1))(Object.create(items))", "indexed write stays own");
+    REQUIRE_EVAL("(d => (d.z = 9, d.z === 9 && !('z' in tags)))(Object.create(tags))", "named write stays own");
+
+    // the views keep the owner alive
+    engine->eval(String::newString("delete globalThis.inv;"));
+    engine->gc();
+    REQUIRE_EVAL("items[1] === 42 && tags.b === 2", "owner alive");
+}
+
+
+int  LazyConverted = 0;
+auto lazyNumbers() {
+    return lazy(std::views::iota(0, 1'000'000) | std::views::transform([](int i) {
+                    ++LazyConverted;
+                    return i * 2;
+                }));
+}
+auto chunkedNumbers() { return chunked(std::views::iota(0, 10), 4); }
+auto LazyMeta = defClass<void>("Lazy").func("numbers", &lazyNumbers).func("chunks", &chunkedNumbers).build();
+TEST_CASE_METHOD(BindingTestFixture, "lazy iterables from ranges") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(LazyMeta);
+
+    LazyConverted = 0;
+    REQUIRE_EVAL(
+        "(() => { let n = 0; for (const v of Lazy.numbers()) if (++n === 5) break; return n; })() === 5",
+        "break early"
+    );
+    REQUIRE(LazyConverted == 5);
+
+    REQUIRE_EVAL("Lazy.numbers().next().value === 0", "next");
+    REQUIRE_EVAL("(() => { const it = Lazy.numbers(); it.return(); return it.next().done; })()", "return");
+    REQUIRE_THROWS(engine->eval(String::newString("Object.create(Lazy.numbers()).next()"))); // not an iterator
+    REQUIRE_EVAL("[...Lazy.chunks()].map(c => c.length).join() === '4,4,2'", "chunked");
+    REQUIRE_EVAL("[...Lazy.chunks()].flat().join() === '0,1,2,3,4,5,6,7,8,9'", "chunked values");
+}
+
+
+std::function<int(int)> StoredCallback;
+
+int applyTwice(std::function<int(int)> const& fn, int value) { return fn(fn(value)); }
+
+std::function<int(int)> makeAdder(int base) {
+    return [base](int value) { return base + value; };
+}
+auto CallbackMeta = defClass<void>("Callbacks")
+                        .func("applyTwice", &applyTwice)
+                        .func("makeAdder", &makeAdder)
+                        .func("store", [](std::function<int(int)> fn) { StoredCallback = std::move(fn); })
+                        .build();
+TEST_CASE_METHOD(BindingTestFixture, "std::function conversion") {
+    {
+        EngineScope scope{engine.get()};
+        engine->registerClass(CallbackMeta);
+
+        REQUIRE_EVAL("Callbacks.applyTwice(x => x * 3, 2) === 18", "script -> std::function");
+        REQUIRE_EVAL("Callbacks.makeAdder(10)(5) === 15", "std::function -> script");
+        REQUIRE_EVAL("Callbacks.applyTwice(Callbacks.makeAdder(1), 1) === 3", "round trip");
+        REQUIRE_THROWS(engine->eval(String::newString("new (Callbacks.makeAdder(1))()")));
+
+        engine->eval(String::newString("Callbacks.store(x => x * 2)"));
+    }
+    REQUIRE(StoredCallback(4) == 8); // outside of any EngineScope
+    StoredCallback = nullptr;
+}
+
+
+class Resource {
+public:
+    int id_;
+
+    explicit Resource(int id) : id_(id) {}
+
+    int getId() const { return id_; }
+};
+std::vector<std::shared_ptr<Resource>> KeptResources;
+std::weak_ptr<Resource>                WatchedResource;
+
+std::shared_ptr<Resource> makeSharedResource(int id) { return std::make_shared<Resource>(id); }
+long                      keepResource(std::shared_ptr<Resource> res) {
+    KeptResources.push_back(std::move(res));
+    return KeptResources.back().use_count();
+}
+void      watchResource(std::weak_ptr<Resource> res) { WatchedResource = std::move(res); }
+Resource* borrowResource() {
+    static Resource instance{-1};
+    return &instance;
+}
+auto ResourceMeta     = defClass<Resource>("Resource").ctor<int>().method("getId", &Resource::getId).build();
+auto ResourceFuncMeta = defClass<void>("Resources")
+                            .func("makeShared", &makeSharedResource)
+                            .func("keep", &keepResource)
+                            .func("watch", &watchResource)
+                            .func("borrow", &borrowResource, ReturnValuePolicy::kReference)
+                            .build();
+TEST_CASE_METHOD(BindingTestFixture, "shared_ptr / weak_ptr conversion") {
+    {
+        EngineScope scope{engine.get()};
+        engine->registerClass(ResourceMeta);
+        engine->registerClass(ResourceFuncMeta);
+
+        // script-owned instance: the unique holder is converted, the object stays in place
+        engine->eval(String::newString("globalThis.res = new Resource(1);"));
+        REQUIRE_EVAL("Resources.keep(res) === 2", "shared with wrapper");
+        REQUIRE_EVAL("Resources.keep(res) === 3 && res.getId() === 1", "same control block");
+
+        REQUIRE_EVAL("Resources.keep(Resources.makeShared(2)) === 2", "shared holder");
+        REQUIRE_THROWS(engine->eval(String::newString("Resources.keep(Resources.borrow())")));
+
+        engine->eval(String::newString("Resources.watch(new Resource(3));"));
+        engine->eval(String::newString("delete globalThis.res;"));
+    }
+    engine->gc();
+    REQUIRE(WatchedResource.expired());
+    REQUIRE(KeptResources.size() == 3);
+    REQUIRE(KeptResources[0] == KeptResources[1]);
+    REQUIRE(KeptResources[0].use_count() == 2); // outlives the collected wrapper
+    REQUIRE(KeptResources[2]->getId() == 2);
+    KeptResources.clear();
+}
+
+
+struct Vec3 {
+    float x, y, z;
+
+    Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    float length() const { return std::sqrt(x * x + y * y + z * z); }
+    void  scale(float factor) {
+        x *= factor;
+        y *= factor;
+        z *= factor;
+    }
+    Vec3 add(Vec3 const& other) const { return {x + other.x, y + other.y, z + other.z}; }
+    Vec3 const& self() const { return *this; } // reference into the stack copy, must be copied out
+
+    static Vec3 up() { return {0, 1, 0}; }
+};
+
+} // namespace ut
+V8KIT_INLINE_VALUE(ut::Vec3);
+namespace ut {
+
+auto Vec3Meta = defClass<Vec3>("Vec3")
+                    .ctor<float, float, float>()
+                    .func("up", &Vec3::up)
+                    .method("length", &Vec3::length)
+                    .method("scale", &Vec3::scale)
+                    .method("add", &Vec3::add)
+                    .method("self", &Vec3::self, ReturnValuePolicy::kReferenceInternal)
+                    .prop("x", &Vec3::x)
+                    .prop("y", &Vec3::y)
+                    .prop("z", &Vec3::z)
+                    .build();
+int  entityId(Entity const& entity) { return entity.getId(); }
+auto EntityProbeMeta = defClass<void>("EntityProbe").func("id", &entityId).build();
+TEST_CASE_METHOD(BindingTestFixture, "inline value classes") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(Vec3Meta);
+    REQUIRE(Vec3Meta.instanceMeta_.inlineSize_ == sizeof(Vec3));
+
+    REQUIRE_EVAL("new Vec3(1, 2, 2).length() === 3", "constructed in place");
+    REQUIRE_EVAL("Vec3.up() instanceof Vec3 && Vec3.up().length() === 1", "returned by value");
+
+    engine->eval(String::newString("globalThis.v = new Vec3(-1.5, 0, 2); v.scale(2);"));
+    REQUIRE_EVAL("v.length() === 5", "mutation written back");
+    REQUIRE_EVAL("v.add(Vec3.up()).add(v).length() > 0", "passed by value");
+
+    engine->eval(String::newString("globalThis.s = v.self(); v.scale(0);"));
+    REQUIRE_EVAL("s.length() === 5 && v.length() === 0", "references are copied out");
+
+    auto v = toCpp<Vec3>(engine->globalThis().get(String::newString("s")));
+    REQUIRE(v.x == -3.0f);
+    REQUIRE(v.z == 4.0f);
+
+    auto js = toJs(Vec3{7, 8, 9});
+    REQUIRE(engine->isInstanceOf(js.asObject(), Vec3Meta));
+    REQUIRE(engine->getInstancePayload(js.asObject()) == nullptr); // no native instance behind it
+    REQUIRE(toCpp<Vec3 const&>(js).y == 8.0f);
+
+    REQUIRE_THROWS(toCpp<Vec3>(Object::newObject()));
+    REQUIRE_THROWS(engine->eval(String::newString("Vec3.prototype.length.call({})")));
+
+    // where another class is expected an inline value is rejected, not read as an instance
+    engine->registerClass(EntityMeta);
+    engine->registerClass(EntityProbeMeta);
+    engine->registerClass(ResourceMeta);
+    engine->registerClass(ResourceFuncMeta);
+    REQUIRE_EVAL(
+        "(() => { try { EntityProbe.id(new Vec3(1, 2, 3)); } catch (e) { return e instanceof TypeError; } })()",
+        "by reference"
+    );
+    REQUIRE_EVAL(
+        "(() => { try { Resources.keep(Vec3.up()); } catch (e) { return e instanceof TypeError; } })()",
+        "by shared_ptr"
+    );
+    REQUIRE_THROWS_AS(toCpp<Entity*>(js), Exception);
+}
+
+
+class Player {
+public:
+    std::string name;
+    int         hp{100};
+    int const   id;
+
+    explicit Player(int id) : id(id) {}
+
+    int  getLevel() const { return level_; }
+    void setLevel(int level) { level_ = level; }
+
+private:
+    int level_{1};
+};
+auto PlayerMeta = defClass<Player>("Player")
+                      .ctor<int>()
+                      .prop("name", &Player::name)
+                      .prop("hp", &Player::hp)
+                      .prop("level", &Player::getLevel, &Player::setLevel)
+                      .prop_readonly("id", &Player::id)
+                      .build();
+
+class Hero : public Player {
+public:
+    int  mana{10};
+    bool flying{false};
+
+    explicit Hero(int id) : Player(id) {}
+};
+auto HeroMeta = defClass<Hero>("Hero")
+                    .ctor<int>()
+                    .inherit<Player>(PlayerMeta)
+                    .prop("mana", &Hero::mana)
+                    .prop("flying", &Hero::flying)
+                    .build();
+TEST_CASE_METHOD(BindingTestFixture, "instance properties and bulk $assign / $snapshot") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(PlayerMeta);
+    engine->registerClass(Vec3Meta);
+
+    engine->eval(String::newString("globalThis.p = new Player(7); p.name = 'alex'; p.level = 3;"));
+    REQUIRE_EVAL("p.name === 'alex' && p.hp === 100 && p.level === 3 && p.id === 7", "accessors");
+
+    REQUIRE_EVAL("p.$assign({hp: 50, level: 9, unknown: 1}) === p", "returns this");
+    REQUIRE_EVAL("p.hp === 50 && p.level === 9 && p.name === 'alex'", "absent keys are kept");
+
+    engine->eval(String::newString("globalThis.snap = p.$snapshot();"));
+    REQUIRE_EVAL("Object.keys(snap).join() === 'name,hp,level,id'", "snapshot keys in declaration order");
+    REQUIRE_EVAL("snap.name === 'alex' && snap.hp === 50 && snap.level === 9 && snap.id === 7", "snapshot values");
+    REQUIRE_EVAL("p.$assign(p.$snapshot()) === p", "read-only properties are skipped");
+    REQUIRE_THROWS(engine->eval(String::newString("p.$assign(1)")));
+
+    auto player = toCpp<Player*>(engine->globalThis().get(String::newString("p")));
+    REQUIRE(player->hp == 50);
+    REQUIRE(player->getLevel() == 9);
+
+    // derived classes: inherited properties come first, then the own ones
+    engine->registerClass(HeroMeta);
+    engine->eval(String::newString("globalThis.h = new Hero(8); h.$assign({name: 'bo', hp: 70, mana: 5});"));
+    REQUIRE_EVAL("h.name === 'bo' && h.hp === 70 && h.mana === 5", "assign reaches inherited properties");
+    REQUIRE_EVAL("Object.keys(h.$snapshot()).join() === 'name,hp,level,id,mana,flying'", "inherited snapshot keys");
+    REQUIRE_EVAL("(s => s.id === 8 && s.hp === 70 && s.flying === false)(h.$snapshot())", "inherited snapshot values");
+    REQUIRE_EVAL("Object.keys(p.$snapshot()).join() === 'name,hp,level,id'", "base snapshot unchanged");
+
+    // inline values: the bulk members work on the stack copy and write it back once
+    engine->eval(String::newString("globalThis.v = new Vec3(1, 2, 3); v.$assign({x: 3, z: 4});"));
+    REQUIRE_EVAL("v.x === 3 && v.y === 2 && v.z === 4", "partial assign");
+    REQUIRE_EVAL("(s => s.x === 3 && s.y === 2 && s.z === 4)(v.$snapshot())", "inline snapshot");
+}
+
+
+Task<int> twiceWhenResolved(Local<Promise> promise) {
+    auto value = co_await promise;
+    co_return value.asNumber().getInt32() * 2;
+}
+Task<> failWhenResolved(Local<Promise> promise) {
+    co_await promise;
+    throw Exception{"failed after await", Exception::Type::RangeError};
+}
+Task<std::string> greetWhenResolved(std::string name, Local<Promise> promise) {
+    co_await promise;
+    co_return "hello " + name; // taken by value: the coroutine frame owns it across the suspension
+}
+Task<std::string> chainedTasks() {
+    auto value = co_await twiceWhenResolved(Promise::newResolved(Number::newNumber(4)));
+    co_return std::to_string(value);
+}
+auto AsyncMeta = defClass<void>("Async")
+                     .func("twice", &twiceWhenResolved)
+                     .func("fail", &failWhenResolved)
+                     .func("chained", &chainedTasks)
+                     .func("greet", &greetWhenResolved)
+                     .build();
+TEST_CASE_METHOD(BindingTestFixture, "coroutines: Task<T> and co_await Local<Promise>") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(AsyncMeta);
+
+    engine->eval(String::newString("globalThis.log = []; globalThis.gate = new Promise(r => globalThis.release = r);"));
+    REQUIRE_EVAL("Async.twice(gate) instanceof Promise", "promise returned");
+    engine->eval(String::newString(R"(
+        Async.twice(gate).then(v => log.push(v));
+        Async.fail(gate).catch(e => log.push(e instanceof RangeError ? e.message : 'wrong'));
+        Async.chained().then(v => log.push(v));
+        Async.greet('bob'.repeat(2), gate).then(v => log.push(v));
+    )"));
+    engine->runLoop();
+    REQUIRE_EVAL("log.join() === '8'", "completed without suspending");
+
+    engine->eval(String::newString("release(21)"));
+    REQUIRE(engine->hasPendingTasks()); // resumptions are queued, not run inside the reaction
+    engine->runLoop();
+    REQUIRE_EVAL("log.join() === '8,42,failed after await,hello bobbob'", "resumed from the loop");
+}
+
+
+int slowSquare(int value) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    return value * value;
+}
+std::atomic<int> StartedWaits{0};
+std::atomic<int> FinishedWaits{0};
+std::string      waitUntilCancelled(int maxMillis, CancellationToken const& token) {
+    ++StartedWaits;
+    for (int i = 0; i < maxMillis && !token.isCancelled(); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    ++FinishedWaits;
+    return token.isCancelled() ? "cancelled" : "timeout";
+}
+void failOnWorker() { throw std::runtime_error("worker failure"); }
+
+class Loader {
+public:
+    std::string prefix_;
+
+    Loader() : prefix_("file:") {}
+
+    std::string load(std::string const& path) const { return prefix_ + path; }
+};
+auto AsyncWorkMeta = defClass<void>("AsyncWork")
+                         .func_async("square", &slowSquare)
+                         .func_async("wait", &waitUntilCancelled)
+                         .func_async("fail", &failOnWorker)
+                         .build();
+auto LoaderMeta    = defClass<Loader>("Loader").ctor<>().method_async("load", &Loader::load).build();
+TEST_CASE_METHOD(BindingTestFixture, "async methods on the worker pool") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(AsyncWorkMeta);
+    engine->registerClass(LoaderMeta);
+    engine->setWorkerPool(std::make_shared<WorkerPool>(2));
+
+    engine->eval(String::newString(R"(
+        globalThis.log = [];
+        AsyncWork.square(7).then(v => log.push('square ' + v));
+        new Loader().load('a.txt').then(v => log.push(v));
+        AsyncWork.fail().catch(e => log.push(e.message));
+        const waiting = AsyncWork.wait(10000);
+        waiting.catch(e => log.push(e.message));
+        log.push('cancel ' + waiting.cancel());
+    )"));
+    engine->runLoop(); // waits for the worker results
+    REQUIRE_EVAL("log.length === 5", "all settled");
+    REQUIRE_EVAL("log.includes('square 49') && log.includes('file:a.txt')", "resolved on the engine thread");
+    REQUIRE_EVAL("log.includes('worker failure')", "exceptions reject");
+    REQUIRE_EVAL("log.includes('cancel true') && log.includes('async call cancelled')", "cancelled");
+
+    // one thread, one queued job: a burst is partly refused instead of piling up
+    engine->setWorkerPool(std::make_shared<WorkerPool>(1, 1));
+    engine->eval(String::newString(R"(
+        Promise.allSettled([AsyncWork.square(1), AsyncWork.square(2), AsyncWork.square(3)])
+            .then(r => globalThis.refused = r.filter(x => x.reason instanceof RangeError).length);
+    )"));
+    engine->runLoop();
+    REQUIRE_EVAL("refused >= 1", "backpressure");
+}
+
+TEST_CASE("an engine waits for its async jobs on a shared pool before it is destroyed") {
+    auto pool    = std::make_shared<WorkerPool>(1); // outlives the engine, never joined by it
+    int  started = StartedWaits;
+    int  done    = FinishedWaits;
+    {
+        auto other = std::make_unique<Engine>();
+        {
+            EngineScope scope{other.get()};
+            other->registerClass(AsyncWorkMeta);
+            other->setWorkerPool(pool);
+            other->eval(String::newString("AsyncWork.wait(10000)"));
+        }
+        while (StartedWaits == started) {
+            std::this_thread::yield();
+        }
+    } // cancels the call and blocks until the job returned
+    REQUIRE(FinishedWaits == done + 1);
+}
+
+
+Engine* UnlockedEngine = nullptr;
+bool    enterFromOtherThread(int expected) {
+    bool entered = false;
+    std::thread other{[&] {
+        EngineScope scope{UnlockedEngine}; // would deadlock if the caller still held the engine
+        entered = UnlockedEngine->eval(String::newString("probe")).asNumber().getInt32() == expected;
+    }};
+    other.join();
+    return entered;
+}
+auto UnlockMeta = defClass<void>("Unlock").func("enter", &enterFromOtherThread).releases_engine().build();
+TEST_CASE_METHOD(BindingTestFixture, "releases_engine unlocks around the native call") {
+    EngineScope scope{engine.get()};
+    engine->registerClass(UnlockMeta);
+    UnlockedEngine = engine.get();
+
+    engine->eval(String::newString("globalThis.probe = 42"));
+    REQUIRE_EVAL("Unlock.enter(42) === true", "another thread entered the engine during the call");
+
+    REQUIRE_THROWS_AS(defClass<void>("X").releases_engine(), std::logic_error); // nothing to apply to
+    REQUIRE_THROWS_AS(
+        defClass<void>("X").func("f", &enterFromOtherThread).var_readonly("v", [] { return 1; }).releases_engine(),
+        std::logic_error
+    ); // not directly after the function
+    REQUIRE_THROWS_AS(
+        defClass<void>("X").func("f", [](Local<Value> const& value) { return value.isNumber(); }).releases_engine(),
+        std::logic_error
+    ); // handles need the lock
+    REQUIRE_THROWS_AS(
+        defClass<Player>("X").ctor<int>().method("m", &Player::getLevel).prop("hp", &Player::hp).releases_engine(),
+        std::logic_error
+    );
+}
+
 // TODO:
 // ### 4.1.2 普通类继承绑定
 // - 测试点：
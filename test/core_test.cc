@@ -1,14 +1,25 @@
 #include "v8kit/core/Engine.h"
 #include "v8kit/core/EngineScope.h"
 #include "v8kit/core/Exception.h"
+#include "v8kit/core/Key.h"
 #include "v8kit/core/MetaInfo.h"
 #include "v8kit/core/Reference.h"
+#include "v8kit/core/Snapshot.h"
+#include "v8kit/core/TimerWheel.h"
 #include "v8kit/core/Value.h"
 
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers.hpp"
 #include "catch2/matchers/catch_matchers_exception.hpp"
 
+#include <array>
+#include <chrono>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
 struct CoreTestFixture {
     std::unique_ptr<v8kit::Engine> engine;
     CoreTestFixture() { engine = std::make_unique<v8kit::Engine>(); }
@@ -270,6 +281,36 @@ TEST_CASE("Local<T> via Engine::eval - Array") {
     REQUIRE(a[1].asNumber().getInt32() == 2);
 }
 
+TEST_CASE("Local<T> via Engine::eval - Map & Set") {
+    using namespace v8kit;
+    std::unique_ptr<Engine> engine = std::make_unique<Engine>();
+    EngineScope enter{engine.get()};
+
+    auto m = engine->eval(String::newString("new Map([[1, 'a'], [2, 'b']])"));
+    REQUIRE(m.isMap());
+    REQUIRE(m.kind() == ValueKind::kMap);
+    auto map = m.asMap();
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.get(Number::newNumber(2)).asString().getValue() == "b");
+    map.set(Number::newNumber(3), String::newString("c"));
+    REQUIRE(map.has(Number::newNumber(3)));
+    REQUIRE(map.remove(Number::newNumber(1)));
+    REQUIRE(map.toArray().length() == 4);
+
+    auto s = engine->eval(String::newString("new Set([1, 2, 2])"));
+    REQUIRE(s.kind() == ValueKind::kSet);
+    REQUIRE(s.asSet().size() == 2);
+
+    REQUIRE(engine->eval(String::newString("[]")).kind() == ValueKind::kArray);
+    REQUIRE(engine->eval(String::newString("(() => {})")).kind() == ValueKind::kFunction);
+
+    Local<String> keys[]   = {String::newString("x"), String::newString("y")};
+    Local<Value>  values[] = {Number::newNumber(1), Number::newNumber(2)};
+    auto          obj      = Object::newObject(keys, values);
+    REQUIRE(obj.get(String::newString("y")).asNumber().getInt32() == 2);
+    REQUIRE(obj.instanceof(engine->globalThis().get(String::newString("Object"))));
+}
+
 TEST_CASE("Local<T> via Engine::eval - Function") {
     using namespace v8kit;
     std::unique_ptr<Engine> engine = std::make_unique<Engine>();
@@ -320,4 +361,336 @@ TEST_CASE("Local<T> via Engine::eval - operator== and clear") {
     REQUIRE(n1 == n2.asValue());
     n1.clear();
     REQUIRE_FALSE(n1.isNumber());
-}
\ No newline at end of file
+}
+TEST_CASE_METHOD(CoreTestFixture, "Snapshot capture & materialize") {
+    using namespace v8kit;
+
+    Snapshot snap;
+    {
+        EngineScope enter{engine.get()};
+        snap = Snapshot::capture(engine->eval(String::newString(
+            "({ name: 'a', tags: ['x', 'a', undefined], nested: { ok: true, n: 1.5 }, fn() {}, 7: 'seven' })"
+        )));
+
+        auto cyclic = engine->eval(String::newString("const o = {}; o.self = o; o"));
+        REQUIRE_THROWS_MATCHES(
+            Snapshot::capture(cyclic),
+            Exception,
+            Catch::Matchers::ExceptionMessageMatcher("Snapshot: cyclic structure")
+        );
+    }
+
+    // read without the engine
+    auto root = snap.root();
+    REQUIRE(root.isObject());
+    REQUIRE(root.size() == 4); // fn dropped
+    REQUIRE(root.find("name")->asString() == "a");
+    REQUIRE(root.find("7")->asString() == "seven");
+    auto tags = *root.find("tags");
+    REQUIRE(tags.size() == 3);
+    REQUIRE(tags[1].asString() == "a");
+    REQUIRE(tags[2].isNull());
+    REQUIRE(root.find("nested")->find("n")->asNumber() == 1.5);
+    REQUIRE_FALSE(root.find("fn").has_value());
+
+    Snapshot::Builder b;
+    auto              list = b.array({b.number(1), b.string("two")});
+    Snapshot          built = std::move(b).build(b.object({{"list", list}, {"ok", b.boolean(false)}}));
+
+    EngineScope enter{engine.get()};
+    engine->globalThis().set(String::newString("captured"), snap.materialize());
+    engine->globalThis().set(String::newString("built"), built.materialize());
+    auto result = engine->eval(String::newString(
+        "JSON.stringify(captured) === "
+        "'{\"7\":\"seven\",\"name\":\"a\",\"tags\":[\"x\",\"a\",null],\"nested\":{\"ok\":true,\"n\":1.5}}'"
+        " && JSON.stringify(built) === '{\"list\":[1,\"two\"],\"ok\":false}'"
+    ));
+    REQUIRE(result.asBoolean().getValue());
+}
+
+TEST_CASE_METHOD(CoreTestFixture, "Engine::parseJson & stringify") {
+    using namespace v8kit;
+    EngineScope enter{engine.get()};
+
+    auto value = engine->parseJson(R"({"a": [1, 2, {"b": "c"}], "d": null})");
+    REQUIRE(value.isObject());
+    REQUIRE(engine->stringify(value) == R"({"a":[1,2,{"b":"c"}],"d":null})");
+    REQUIRE(engine->stringify(engine->eval(String::newString("undefined"))).empty());
+    REQUIRE(engine->stringify(engine->eval(String::newString("(() => 1)"))).empty());
+    REQUIRE(engine->stringify(engine->eval(String::newString("Symbol('s')"))).empty());
+    REQUIRE(engine->stringify(engine->eval(String::newString("({toJSON() { return undefined; }})"))).empty());
+    REQUIRE(engine->stringify(String::newString("undefined")) == R"("undefined")");
+
+    // large ASCII payload handed over as an external string
+    std::string large = "[";
+    for (int i = 0; i < 10000; ++i) {
+        large += std::to_string(i) + ",";
+    }
+    large.back() = ']';
+    auto array   = engine->parseJson(std::move(large));
+    REQUIRE(array.asArray().length() == 10000);
+    REQUIRE(array.asArray().get(9999).asNumber().getInt32() == 9999);
+
+    REQUIRE_THROWS_AS(engine->parseJson("{oops}"), Exception);
+}
+
+TEST_CASE("Snapshot::parseJson") {
+    using namespace v8kit;
+
+    auto snap = Snapshot::parseJson(R"( {"s": "a\"bé😀", "n": -1.5e2, "k": 1, "k": 2, "e": [], "z": 1e400} )");
+    auto root = snap.root();
+    REQUIRE(root.size() == 5); // duplicate key collapsed
+    REQUIRE(root.find("s")->asString() == "a\"b\xC3\xA9\xF0\x9F\x98\x80");
+    REQUIRE(root.find("n")->asNumber() == -150);
+    REQUIRE(root.find("k")->asNumber() == 2);
+    REQUIRE(root.find("e")->size() == 0);
+    REQUIRE(root.find("z")->asNumber() == std::numeric_limits<double>::infinity());
+
+    REQUIRE_THROWS_AS(Snapshot::parseJson("[1,]"), Exception);
+    REQUIRE_THROWS_AS(Snapshot::parseJson("01"), Exception);
+    REQUIRE_THROWS_AS(Snapshot::parseJson("\"a"), Exception);
+    REQUIRE_THROWS_AS(Snapshot::parseJson("[] []"), Exception);
+    REQUIRE_THROWS_AS(Snapshot::parseJson(std::string(100, '[') + std::string(100, ']')), Exception);
+}
+
+TEST_CASE_METHOD(CoreTestFixture, "Local<Object>::forEachOwnProperty") {
+    using namespace v8kit;
+    EngineScope enter{engine.get()};
+
+    auto object = engine->eval(String::newString(
+        "const o = Object.create({ inherited: 1 });"
+        "o.a = 1; o[2] = 'two'; o[Symbol('s')] = 3; o['" + std::string(200, 'k') + "'] = 4;"
+        "Object.defineProperty(o, 'hidden', { value: 5, enumerable: false });"
+        "for (let i = 0; i < 100; ++i) o['p' + i] = i;"
+        "o"
+    )).asObject();
+
+    std::vector<std::string> keys;
+    double                   sum = 0;
+    object.forEachOwnProperty([&](std::string_view key, Local<Value> const& value) {
+        keys.emplace_back(key);
+        if (value.isNumber()) sum += value.asNumber().getDouble();
+    });
+    REQUIRE(keys.size() == 103);
+    REQUIRE(keys[0] == "2"); // index keys first, as in Object.keys
+    REQUIRE(keys[1] == "a");
+    REQUIRE(keys[2] == std::string(200, 'k'));
+    REQUIRE(sum == 1 + 4 + 4950);
+
+    size_t visited = 0;
+    object.forEachOwnProperty([&](Local<String> const& key, Local<Value> const&) {
+        ++visited;
+        return key.getValue() != "a"; // stop
+    });
+    REQUIRE(visited == 2);
+}
+
+TEST_CASE_METHOD(CoreTestFixture, "Local<Object> batched properties") {
+    using namespace v8kit;
+    EngineScope enter{engine.get()};
+
+    auto object = Object::newObject();
+
+    std::array<Local<String>, 3> keys{String::newString("a"), String::newString("b"), String::newString("c")};
+    std::array<Local<Value>, 3>  values{Number::newNumber(1), String::newString("two"), Boolean::newBoolean(true)};
+    object.setMany(keys, values);
+
+    std::array<std::pair<Local<String>, Local<Value>>, 1> more{{{String::newString("d"), Number::newNumber(4)}}};
+    object.setMany(more);
+
+    std::array<Local<String>, 3> read{String::newString("d"), String::newString("b"), String::newString("missing")};
+    std::array<Local<Value>, 3>  out;
+    object.getMany(read, out);
+    REQUIRE(out[0].asNumber().getInt32() == 4);
+    REQUIRE(out[1].asString().getValue() == "two");
+    REQUIRE(out[2].isUndefined());
+    REQUIRE_THROWS_AS(object.getMany(read, std::span{out}.first(2)), Exception);
+    REQUIRE_THROWS_AS(object.setMany(keys, std::span<const Local<Value>>{values}.first(2)), Exception);
+
+    REQUIRE(object.defineOwnProperties(keys, values, PropertyAttribute::ReadOnly));
+    engine->globalThis().set(String::newString("batched"), object);
+    REQUIRE(engine->eval(String::newString("batched.a = 5; batched.a === 1")).asBoolean().getValue());
+
+    auto throwing = engine->eval(String::newString("({ set a(v) { throw new Error('nope'); } })")).asObject();
+    REQUIRE_THROWS_AS(throwing.setMany(keys, values), Exception);
+    REQUIRE_THROWS_AS(object.setMany(keys, std::span{values}.first(2)), Exception);
+}
+
+TEST_CASE_METHOD(CoreTestFixture, "Key literals") {
+    using namespace v8kit;
+    using namespace v8kit::literals;
+    EngineScope enter{engine.get()};
+
+    auto object = engine->eval(String::newString("({ name: 'v8kit', id: 1 })")).asObject();
+    REQUIRE(object.get("name"_key).asString().getValue() == "v8kit");
+    REQUIRE(object.has(Key<"id">{}));
+    REQUIRE_FALSE(object.has("missing"_key));
+
+    object.set("name"_key, String::newString("changed"));
+    REQUIRE(object.get(Key<"name">{}).asString().getValue() == "changed");
+
+    // one id per literal, shared by both spellings; the string is cached per engine
+    REQUIRE(Key<"name">::id() == decltype("name"_key)::id());
+    REQUIRE(Key<"name">::id() != Key<"id">::id());
+    REQUIRE(Key<"name">{}.get() == Key<"name">{}.get().asValue());
+
+    auto other = std::make_unique<Engine>();
+    {
+        EngineScope inner{other.get()};
+        REQUIRE(Key<"name">{}.get().getValue() == "name");
+    }
+}
+
+TEST_CASE_METHOD(CoreTestFixture, "Promise & event loop") {
+    using namespace v8kit;
+    EngineScope enter{engine.get()};
+
+    engine->setMicrotasksPolicy(MicrotasksPolicy::kExplicit);
+    REQUIRE(engine->microtasksPolicy() == MicrotasksPolicy::kExplicit);
+
+    auto value = engine->eval(String::newString("globalThis.log = []; Promise.resolve(1)"));
+    REQUIRE(value.isPromise());
+    REQUIRE(value.kind() == ValueKind::kPromise);
+    REQUIRE(value.as<Promise>().state() == PromiseState::kFulfilled);
+    REQUIRE(value.asPromise().result().asNumber().getInt32() == 1);
+
+    // reactions wait for a checkpoint
+    Global<PromiseResolver> resolver{PromiseResolver::newResolver()};
+    auto                    promise = resolver.get().getPromise();
+    REQUIRE(promise.state() == PromiseState::kPending);
+    REQUIRE_THROWS_AS(promise.result(), std::logic_error);
+    promise.then(engine->eval(String::newString("(v) => log.push('then ' + v)")).asFunction());
+
+    engine->postTask([&] { resolver.get().resolve(String::newString("a")); });
+    engine->postTask([&] {
+        engine->eval(String::newString("log.push('task'); queueMicrotask(() => log.push('micro'))"));
+        engine->postTask([&] { engine->eval(String::newString("log.push('next tick')")); });
+    });
+    REQUIRE(engine->hasPendingTasks());
+    REQUIRE(engine->runOnce() == 2);
+    REQUIRE(engine->stringify(engine->eval(String::newString("log"))) == R"(["then a","task","micro"])");
+
+    REQUIRE(engine->hasPendingTasks()); // posted during the tick
+    engine->runLoop();
+    REQUIRE_FALSE(engine->hasPendingTasks());
+    REQUIRE(engine->eval(String::newString("log.length")).asNumber().getInt32() == 4);
+
+    auto rejected = Promise::newRejected(String::newString("nope"));
+    rejected.markAsHandled();
+    REQUIRE(rejected.state() == PromiseState::kRejected);
+    REQUIRE(Promise::newResolved(Number::newNumber(2)).result().asNumber().getInt32() == 2);
+
+    // an expired deadline still runs one task per tick
+    engine->postTask([] {});
+    engine->postTask([] {});
+    REQUIRE(engine->runOnce(std::chrono::steady_clock::now()) == 1);
+    REQUIRE(engine->runOnce() == 1);
+}
+
+TEST_CASE("TimerWheel") {
+    using namespace v8kit;
+    using namespace std::chrono_literals;
+    auto       origin = TimerWheel::Clock::now();
+    TimerWheel wheel{origin};
+
+    wheel.schedule(1, origin + 300ms);  // level 1
+    wheel.schedule(2, origin + 70s);    // level 2, cascades twice
+    wheel.schedule(3, origin + 1500us); // rounded up to 2ms
+    wheel.schedule(4, origin + 5ms);
+    wheel.schedule(5, origin - 1s); // already due
+    REQUIRE(wheel.cancel(4));
+    REQUIRE_FALSE(wheel.cancel(4));
+    REQUIRE(wheel.size() == 4);
+    REQUIRE(wheel.nextWakeup() == origin);
+
+    std::vector<TimerId> expired;
+    wheel.advance(origin + 1ms, expired);
+    REQUIRE(expired == std::vector<TimerId>{5});
+    wheel.advance(origin + 299ms, expired);
+    REQUIRE(expired == std::vector<TimerId>{5, 3});
+    REQUIRE(wheel.nextWakeup() <= origin + 300ms);
+    wheel.advance(origin + 300ms, expired);
+    REQUIRE(expired.back() == 1);
+    wheel.advance(origin + 69999ms, expired);
+    REQUIRE(expired.size() == 3);
+    wheel.advance(origin + 70s, expired);
+    REQUIRE(expired.back() == 2);
+    REQUIRE(wheel.empty());
+    REQUIRE_FALSE(wheel.nextWakeup().has_value());
+
+    // a past deadline is due on the next tick, not in the millisecond already advanced to
+    wheel.schedule(6, origin);
+    wheel.advance(origin + 70s, expired);
+    REQUIRE(expired.size() == 4);
+    wheel.advance(origin + 70001ms, expired);
+    REQUIRE(expired.back() == 6);
+}
+
+TEST_CASE_METHOD(CoreTestFixture, "Timers & tick budgets") {
+    using namespace v8kit;
+    using namespace std::chrono_literals;
+    EngineScope enter{engine.get()};
+    engine->installTimers();
+
+    engine->eval(String::newString(R"(
+        globalThis.order = [];
+        setTimeout((a, b) => order.push('timeout ' + a + b), 5, 'x', 'y');
+        setTimeout(() => order.push('zero'));
+        clearTimeout(setTimeout(() => order.push('never'), 1));
+        let n = 0;
+        const id = setInterval(() => {
+            order.push('tick');
+            if (++n === 3) clearInterval(id);
+        }, 2);
+    )"));
+    REQUIRE(engine->activeTimers() == 3);
+    engine->runLoop(); // returns once the interval is cleared
+    REQUIRE(engine->activeTimers() == 0);
+    REQUIRE(engine->eval(String::newString("order[0] === 'zero' && order.length === 5")).asBoolean().getValue());
+    REQUIRE(engine->eval(String::newString("order.includes('timeout xy') && n === 3")).asBoolean().getValue());
+    REQUIRE_THROWS_AS(engine->eval(String::newString("setTimeout(1)")), Exception);
+
+    // ids that no timer can have are ignored
+    auto kept = engine->setTimer(1s, [] {});
+    engine->eval(String::newString("[NaN, Infinity, -1, 0, 1e300, '1', {}].forEach(id => clearTimeout(id))"));
+    REQUIRE(engine->activeTimers() == 1);
+    REQUIRE(engine->clearTimer(kept));
+
+    // a manual clock: each timer takes 3ms, a 5ms budget stops after the second one and carries the rest over
+    auto now = std::chrono::steady_clock::time_point{};
+    engine->setClock([&] { return now; });
+    int fired = 0;
+    for (int i = 0; i < 4; ++i) {
+        engine->setTimer(0ms, [&] {
+            ++fired;
+            now += 3ms;
+        });
+    }
+    auto cleared = engine->setTimer(0ms, [&] { fired += 100; });
+    REQUIRE(engine->clearTimer(cleared));
+    REQUIRE_THROWS_AS(engine->setClock(&std::chrono::steady_clock::now), std::logic_error);
+
+    auto first = engine->runFor(5ms);
+    REQUIRE(first.timersRun == 2);
+    REQUIRE(first.carriedOver == 2);
+    REQUIRE(first.elapsed == 6ms);
+    REQUIRE(first.overrun == 1ms);
+    REQUIRE(engine->hasPendingTasks()); // the carried over timers
+
+    auto second = engine->runFor(1s);
+    REQUIRE(second.timersRun == 2);
+    REQUIRE(second.carriedOver == 0);
+    REQUIRE(second.overrun == 0ms);
+    REQUIRE(fired == 4);
+    REQUIRE_FALSE(engine->hasPendingTasks());
+
+    engine->setTimer(10ms, [&] { ++fired; });
+    now += 9ms;
+    REQUIRE(engine->runFor(1s).timersRun == 0);
+    now += 1ms;
+    REQUIRE(engine->runFor(1s).timersRun == 1); // fires on the manual clock, not in real time
+
+    REQUIRE(engine->tickStats().ticks == 4);
+    REQUIRE(engine->tickStats().overruns == 1);
+    REQUIRE(engine->tickStats().worstOverrun == 1ms);
+}
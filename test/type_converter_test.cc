@@ -1,14 +1,46 @@
+#include "v8kit/binding/MetaBuilder.h"
+#include "v8kit/binding/ObjectPatcher.h"
+#include "v8kit/binding/SnapshotConverter.h"
 #include "v8kit/binding/TypeConverter.h"
+#include "v8kit/core/EngineScope.h"
 
 #include "catch2/catch_test_macros.hpp"
 #include <catch2/catch_approx.hpp>
 
+#include <map>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
+struct ReflectedPoint {
+    int                x{0};
+    double             y{0};
+    std::string        label;
+    std::vector<int>   tags;
+    std::optional<int> extra;
+};
+V8KIT_REFLECT(
+    ReflectedPoint,
+    field("x", &ReflectedPoint::x),
+    field("y", &ReflectedPoint::y),
+    field("label", &ReflectedPoint::label),
+    field("tags", &ReflectedPoint::tags),
+    field("extra", &ReflectedPoint::extra)
+);
+
+enum class LogLevel { Info = 1, Warning = 2, Error = 4 };
+inline v8kit::EnumMeta const LogLevelMeta = v8kit::binding::defEnum<LogLevel>("LogLevel")
+                                                .value("info", LogLevel::Info)
+                                                .value("warning", LogLevel::Warning)
+                                                .value("error", LogLevel::Error)
+                                                .stringValues()
+                                                .build();
+V8KIT_STRING_ENUM(LogLevel, LogLevelMeta);
+
 TEST_CASE("TypeConverter full test") {
     auto               engine = std::make_unique<v8kit::Engine>();
     v8kit::EngineScope enter{engine.get()};
@@ -103,6 +135,20 @@ TEST_CASE("TypeConverter full test") {
     std::vector<int> cpp_vec = toCpp<std::vector<int>>(js_vec);
     REQUIRE(cpp_vec == vec);
 
+    // bulk paths: numeric arrays are read in one pass, mixed arrays fall back to per-element conversion
+    auto js_doubles = engine->eval(v8kit::String::newString("[0.5, 1.5, 2.5]"));
+    REQUIRE(toCpp<std::vector<double>>(js_doubles) == std::vector<double>{0.5, 1.5, 2.5});
+
+    auto js_mixed = engine->eval(v8kit::String::newString("[1, 2n, 3]"));
+    REQUIRE(toCpp<std::vector<int64_t>>(js_mixed) == std::vector<int64_t>{1, 2, 3});
+
+    std::vector<std::string> strs    = {"a", "b", "c"};
+    auto                     js_strs = toJs(strs);
+    REQUIRE(js_strs.asArray().length() == 3);
+    REQUIRE(toCpp<std::vector<std::string>>(js_strs) == strs);
+
+    REQUIRE(toJs(std::vector<int>{}).asArray().length() == 0);
+
     // ----------------------------
     // unordered_map
     // ----------------------------
@@ -116,6 +162,50 @@ TEST_CASE("TypeConverter full test") {
     auto cpp_map = toCpp<std::unordered_map<std::string, int>>(js_map);
     REQUIRE(cpp_map == map);
 
+    // non-string keys <-> Map
+    std::map<int, std::string> int_map    = {{1, "one"}, {2, "two"}};
+    auto                       js_int_map = toJs(int_map);
+    REQUIRE(js_int_map.isMap());
+    REQUIRE(js_int_map.kind() == v8kit::ValueKind::kMap);
+    REQUIRE(js_int_map.asMap().size() == 2);
+    REQUIRE(toCpp<std::map<int, std::string>>(js_int_map) == int_map);
+
+    // string-keyed maps also accept a JavaScript Map
+    auto js_str_map = engine->eval(v8kit::String::newString("new Map([['a', 1], ['b', 2]])"));
+    REQUIRE(toCpp<std::map<std::string, int>>(js_str_map) == std::map<std::string, int>{{"a", 1}, {"b", 2}});
+
+    // ----------------------------
+    // set
+    // ----------------------------
+    std::set<int> set    = {3, 1, 2};
+    auto          js_set = toJs(set);
+    REQUIRE(js_set.isSet());
+    REQUIRE(js_set.asSet().has(toJs(2)));
+    REQUIRE(toCpp<std::set<int>>(js_set) == set);
+    REQUIRE(toCpp<std::unordered_set<int>>(toJs(std::vector<int>{1, 1, 2})) == std::unordered_set<int>{1, 2});
+
+    // ----------------------------
+    // reflected struct
+    // ----------------------------
+    ReflectedPoint point{1, 2.5, "p", {7, 8}, std::nullopt};
+    auto           js_point = toJs(point);
+    REQUIRE(js_point.isObject());
+    REQUIRE(js_point.asObject().get(v8kit::String::newString("label")).asString().getValue() == "p");
+    REQUIRE(js_point.asObject().get(v8kit::String::newString("extra")).isNull());
+
+    auto cpp_point = toCpp<ReflectedPoint>(js_point);
+    REQUIRE(cpp_point.x == 1);
+    REQUIRE(cpp_point.y == Catch::Approx(2.5));
+    REQUIRE(cpp_point.label == "p");
+    REQUIRE(cpp_point.tags == point.tags);
+    REQUIRE(!cpp_point.extra.has_value());
+
+    auto from_script = toCpp<ReflectedPoint>(
+        engine->eval(v8kit::String::newString("({label: 'js', x: 3, y: 4, tags: [], extra: 5})"))
+    );
+    REQUIRE(from_script.x == 3);
+    REQUIRE(from_script.extra == 5);
+
     // ----------------------------
     // pair
     // ----------------------------
@@ -167,3 +257,119 @@ TEST_CASE("TypeConverter full test") {
     REQUIRE(!cpp_nested[1].has_value());
     REQUIRE(cpp_nested[2] == 3);
 }
+
+TEST_CASE("fromJson into reflected structs") {
+    using namespace v8kit::binding;
+
+    // no engine involved
+    auto point = fromJson<ReflectedPoint>(R"({"x": 3, "y": 0.5, "label": "p", "tags": [1, 2]})");
+    REQUIRE(point.x == 3);
+    REQUIRE(point.y == 0.5);
+    REQUIRE(point.label == "p");
+    REQUIRE(point.tags == std::vector<int>{1, 2});
+    REQUIRE_FALSE(point.extra.has_value());
+
+    auto points = fromJson<std::map<std::string, std::vector<ReflectedPoint>>>(
+        R"({"a": [{"x": 1, "y": 2, "label": "", "tags": [], "extra": 7}]})"
+    );
+    REQUIRE(points["a"].at(0).extra == 7);
+
+    REQUIRE_THROWS_AS(fromJson<ReflectedPoint>(R"({"x": 1})"), v8kit::Exception); // missing field
+    REQUIRE_THROWS_AS(fromJson<ReflectedPoint>(R"({"x": "1", "y": 0, "label": "", "tags": []})"), v8kit::Exception);
+    REQUIRE_THROWS_AS(fromJson<int>("1e300"), v8kit::Exception); // out of range, not a wrapped cast
+    REQUIRE_THROWS_AS(fromJson<uint8_t>("256"), v8kit::Exception);
+    REQUIRE_THROWS_AS(fromJson<float>("1e300"), v8kit::Exception);
+    REQUIRE(fromJson<int64_t>("-9007199254740993") == -9007199254740992);
+}
+
+TEST_CASE("TypeConverter large containers use chunked handle scopes") {
+    auto               engine = std::make_unique<v8kit::Engine>();
+    v8kit::EngineScope enter{engine.get()};
+
+    using namespace v8kit::binding;
+
+    std::vector<std::string> strings(50000);
+    for (size_t i = 0; i < strings.size(); ++i) {
+        strings[i] = "s" + std::to_string(i);
+    }
+    auto js_strings = toJs(strings);
+    REQUIRE(js_strings.asArray().length() == strings.size());
+    REQUIRE(toCpp<std::vector<std::string>>(js_strings) == strings);
+
+    std::unordered_map<std::string, int> map;
+    for (int i = 0; i < 5000; ++i) {
+        map.emplace("k" + std::to_string(i), i);
+    }
+    REQUIRE(toCpp<std::unordered_map<std::string, int>>(toJs(map)) == map);
+
+    std::map<int, std::string> ordered;
+    for (int i = 0; i < 5000; ++i) {
+        ordered.emplace(i, std::to_string(i));
+    }
+    REQUIRE(toCpp<std::map<int, std::string>>(toJs(ordered)) == ordered);
+
+    // user loop
+    auto                      array = v8kit::Array::newArray(strings.size());
+    v8kit::ChunkedHandleScope chunk{256};
+    for (size_t i = 0; i < strings.size(); ++i) {
+        array.set(i, toJs(strings[i]));
+        chunk.step();
+    }
+    REQUIRE(toCpp<std::string>(array.get(49999)) == "s49999");
+}
+
+TEST_CASE("String-mapped enums") {
+    auto               engine = std::make_unique<v8kit::Engine>();
+    v8kit::EngineScope enter{engine.get()};
+
+    using namespace v8kit::binding;
+
+    auto js_level = toJs(LogLevel::Warning);
+    REQUIRE(js_level.isString());
+    REQUIRE(js_level.asString().getValue() == "warning");
+    REQUIRE(toCpp<LogLevel>(js_level) == LogLevel::Warning);
+
+    // literal, registered and computed (non-internalized) strings all resolve
+    engine->registerEnum(LogLevelMeta);
+    REQUIRE(toCpp<LogLevel>(engine->eval(v8kit::String::newString("LogLevel.error"))) == LogLevel::Error);
+    REQUIRE(toCpp<LogLevel>(engine->eval(v8kit::String::newString("'info'"))) == LogLevel::Info);
+    REQUIRE(toCpp<LogLevel>(engine->eval(v8kit::String::newString("['warn', 'ing'].join('')"))) == LogLevel::Warning);
+
+    REQUIRE_THROWS(toCpp<LogLevel>(v8kit::String::newString("fatal")));
+    REQUIRE_THROWS(toCpp<LogLevel>(v8kit::Number::newNumber(2)));
+    REQUIRE_THROWS(toJs(static_cast<LogLevel>(3)));
+
+    REQUIRE(fromJson<std::vector<LogLevel>>(R"(["error", "info"])") == std::vector{LogLevel::Error, LogLevel::Info});
+}
+
+TEST_CASE("ObjectPatcher writes only changed fields") {
+    auto               engine = std::make_unique<v8kit::Engine>();
+    v8kit::EngineScope enter{engine.get()};
+
+    using namespace v8kit::binding;
+
+    ReflectedPoint                state{1, 2.5, "a", {1, 2}, std::nullopt};
+    ObjectPatcher<ReflectedPoint> patcher{state};
+    engine->globalThis().set(v8kit::String::newString("point"), patcher.object());
+    REQUIRE(toCpp<ReflectedPoint>(patcher.object()).label == "a");
+    REQUIRE(patcher.push(state) == 0);
+
+    // unchanged fields are not rewritten, so script edits survive a push
+    engine->eval(v8kit::String::newString("point.x = 10; point.label = 'script';"));
+    state.y = 4;
+    REQUIRE(patcher.push(state) == 1);
+    REQUIRE(toCpp<std::string>(engine->eval(v8kit::String::newString("point.label"))) == "script");
+
+    auto modified = patcher.pull(state);
+    REQUIRE(modified == std::vector<std::string_view>{"x", "label"});
+    REQUIRE(state.x == 10);
+    REQUIRE(state.label == "script");
+    REQUIRE(state.y == 4);
+    REQUIRE(patcher.pull(state).empty());
+    REQUIRE(patcher.push(state) == 0);
+
+    // adopting an existing object: nothing is known to be in sync yet
+    ObjectPatcher<ReflectedPoint> adopted{v8kit::Object::newObject()};
+    REQUIRE(adopted.push(state) == 5);
+    REQUIRE(toCpp<ReflectedPoint>(adopted.object()).tags == std::vector<int>{1, 2});
+}